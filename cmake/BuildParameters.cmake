@@ -32,6 +32,14 @@ endif()
 # Compiler extra
 #-------------------------------------------------------------------------------
 option(USE_ASAN "Enable address sanitizer")
+option(ENABLE_JIT_PERF_MAP "Write /tmp/perf-<pid>.map entries for recompiled code")
+option(ENABLE_JIT_BLOCK_COUNTS "Count executions of every recompiled block (implies ENABLE_JIT_PERF_MAP)")
+
+if(ENABLE_JIT_BLOCK_COUNTS)
+	list(APPEND PCSX2_DEFS ENABLE_JIT_PERF_MAP ENABLE_JIT_BLOCK_COUNTS)
+elseif(ENABLE_JIT_PERF_MAP)
+	list(APPEND PCSX2_DEFS ENABLE_JIT_PERF_MAP)
+endif()
 
 if(MSVC AND CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
 	set(USE_CLANG_CL TRUE)
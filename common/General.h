@@ -59,6 +59,10 @@ namespace HostSys
 	extern void* MapSharedMemory(void* handle, size_t offset, void* baseaddr, size_t size, const PageProtectionMode mode);
 	extern void UnmapSharedMemory(void* baseaddr, size_t size);
 
+	/// Maps an entire file read-only. Returns nullptr if the file can't be opened or is empty.
+	extern void* MapFileReadOnly(const char* path, size_t* size);
+	extern void UnmapFile(void* baseaddr, size_t size);
+
 	/// Installs the specified page fault handler. Only one handler can be active at once.
 	bool InstallPageFaultHandler(PageFaultHandler handler);
 
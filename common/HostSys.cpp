@@ -19,6 +19,7 @@
 
 #if !defined(_WIN32)
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <signal.h>
 #include <errno.h>
 #include <fcntl.h>
@@ -415,6 +416,68 @@ void HostSys::UnmapSharedMemory(void* baseaddr, size_t size)
 #endif
 }
 
+void* HostSys::MapFileReadOnly(const char* path, size_t* size)
+{
+#ifdef _WIN32
+	wchar_t* wstr = utf8_to_utf16_string_alloc(path);
+	const HANDLE file = CreateFileW(wstr, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	free(wstr);
+	if (file == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return nullptr;
+	}
+
+	const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping)
+		return nullptr;
+
+	void* ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!ptr)
+		return nullptr;
+
+	*size = static_cast<size_t>(file_size.QuadPart);
+	return ptr;
+#else
+	const int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return nullptr;
+
+	struct stat sd;
+	if (fstat(fd, &sd) != 0 || sd.st_size <= 0)
+	{
+		close(fd);
+		return nullptr;
+	}
+
+	void* ptr = mmap(nullptr, static_cast<size_t>(sd.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (ptr == MAP_FAILED)
+		return nullptr;
+
+	*size = static_cast<size_t>(sd.st_size);
+	return ptr;
+#endif
+}
+
+void HostSys::UnmapFile(void* baseaddr, size_t size)
+{
+	if (!baseaddr)
+		return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(baseaddr);
+#else
+	munmap(baseaddr, size);
+#endif
+}
+
 SharedMemoryMappingArea::SharedMemoryMappingArea(u8* base_ptr, size_t size, size_t num_pages)
 	: m_base_ptr(base_ptr)
 	, m_size(size)
@@ -0,0 +1,145 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Perf.h"
+
+#ifdef ENABLE_JIT_PERF_MAP
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+namespace Perf
+{
+	struct BlockCounter
+	{
+		Subsystem sys;
+		u32 guest_pc;
+		u32 count;
+	};
+
+	static const char* s_subsystem_names[static_cast<u32>(Subsystem::Count)] = {
+		"EE", "IOP", "VU0", "VU1", "VIF0", "VIF1"};
+
+	// Blocks are compiled from the EE thread, and from the MTVU thread for VU1/VIF1.
+	static std::mutex s_lock;
+	static std::FILE* s_map_file = nullptr;
+	static bool s_map_failed = false;
+	static bool s_map_created = false;
+
+#ifdef ENABLE_JIT_BLOCK_COUNTS
+	// Deque, so that pointers handed out to the recompilers remain stable.
+	static std::deque<BlockCounter> s_counters;
+#endif
+
+	static const char* GetSubsystemName(Subsystem sys)
+	{
+		return s_subsystem_names[static_cast<u32>(sys)];
+	}
+
+	static std::FILE* GetMapFile()
+	{
+		if (!s_map_file && !s_map_failed)
+		{
+			const std::string path = fmt::format("/tmp/perf-{}.map", getpid());
+			// Keep entries from earlier sessions of this process, perf resolves samples after exit.
+			s_map_file = std::fopen(path.c_str(), s_map_created ? "a" : "w");
+			s_map_failed = !s_map_file;
+			s_map_created |= !s_map_failed;
+		}
+
+		return s_map_file;
+	}
+
+	void RegisterBlock(Subsystem sys, const void* code, u32 size, u32 guest_pc)
+	{
+		std::unique_lock lock(s_lock);
+		if (std::FILE* fp = GetMapFile())
+			std::fprintf(fp, "%zx %x %s_%08X\n", reinterpret_cast<uptr>(code), size, GetSubsystemName(sys), guest_pc);
+	}
+
+	void RegisterCode(Subsystem sys, const void* code, u32 size, const char* name)
+	{
+		std::unique_lock lock(s_lock);
+		if (std::FILE* fp = GetMapFile())
+			std::fprintf(fp, "%zx %x %s_%s\n", reinterpret_cast<uptr>(code), size, GetSubsystemName(sys), name);
+	}
+
+#ifdef ENABLE_JIT_BLOCK_COUNTS
+	u32* AllocateBlockCounter(Subsystem sys, u32 guest_pc)
+	{
+		std::unique_lock lock(s_lock);
+		return &s_counters.emplace_back(BlockCounter{sys, guest_pc, 0}).count;
+	}
+
+	static void DumpBlockCounts()
+	{
+		// A block recompiled several times has several counters, merge them.
+		std::map<std::pair<Subsystem, u32>, u64> totals;
+		for (const BlockCounter& bc : s_counters)
+		{
+			if (bc.count > 0)
+				totals[{bc.sys, bc.guest_pc}] += bc.count;
+		}
+		s_counters.clear();
+
+		if (totals.empty())
+			return;
+
+		std::vector<std::pair<std::pair<Subsystem, u32>, u64>> sorted(totals.begin(), totals.end());
+		std::sort(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+
+		const std::string path = fmt::format("/tmp/pcsx2-blocks-{}.txt", getpid());
+		std::FILE* fp = std::fopen(path.c_str(), "w");
+		if (!fp)
+			return;
+
+		for (const auto& [key, count] : sorted)
+			std::fprintf(fp, "%llu %s_%08X\n", static_cast<unsigned long long>(count), GetSubsystemName(key.first), key.second);
+
+		std::fclose(fp);
+	}
+#endif
+
+	void Shutdown()
+	{
+		std::unique_lock lock(s_lock);
+
+#ifdef ENABLE_JIT_BLOCK_COUNTS
+		DumpBlockCounts();
+#endif
+
+		if (s_map_file)
+		{
+			std::fclose(s_map_file);
+			s_map_file = nullptr;
+		}
+		s_map_failed = false;
+	}
+} // namespace Perf
+
+#endif
@@ -0,0 +1,61 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "Pcsx2Defs.h"
+
+// Describes recompiled code to host profilers.
+//
+// With ENABLE_JIT_PERF_MAP, every block handed to RegisterBlock() is appended
+// to /tmp/perf-<pid>.map, which perf uses to symbolize anonymous JIT memory.
+// With ENABLE_JIT_BLOCK_COUNTS, the recompilers also bump a counter on each
+// block entry; the totals are written to /tmp/pcsx2-blocks-<pid>.txt at shutdown.
+// Both are build options, and everything here compiles away without them.
+namespace Perf
+{
+	enum class Subsystem : u8
+	{
+		EE,
+		IOP,
+		VU0,
+		VU1,
+		VIF0,
+		VIF1,
+		Count
+	};
+
+#ifdef ENABLE_JIT_PERF_MAP
+	/// Records a block of generated code. For VIF blocks, guest_pc is the unpack type.
+	void RegisterBlock(Subsystem sys, const void* code, u32 size, u32 guest_pc);
+
+	/// Records generated code which doesn't belong to a guest address (dispatchers etc).
+	void RegisterCode(Subsystem sys, const void* code, u32 size, const char* name);
+
+	/// Flushes the block counts and closes the map file.
+	void Shutdown();
+#else
+	__fi static void RegisterBlock(Subsystem sys, const void* code, u32 size, u32 guest_pc) {}
+	__fi static void RegisterCode(Subsystem sys, const void* code, u32 size, const char* name) {}
+	__fi static void Shutdown() {}
+#endif
+
+#ifdef ENABLE_JIT_BLOCK_COUNTS
+	/// Returns a counter the block should increment on entry. Counters stay valid until Shutdown().
+	u32* AllocateBlockCounter(Subsystem sys, u32 guest_pc);
+#else
+	__fi static u32* AllocateBlockCounter(Subsystem sys, u32 guest_pc) { return nullptr; }
+#endif
+} // namespace Perf
@@ -119,6 +119,62 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      "pcsx2_ipu_thread",
+      "System > Threaded IPU",
+      "Threaded IPU",
+      "Runs the IDCT and colour conversion of IPU intra decoding (FMVs) on a separate thread, overlapping it with emulation. Output timing is unchanged. Only helps on CPUs with spare cores.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_spu2_thread",
+      "System > Threaded SPU2 Output",
+      "Threaded SPU2 Output",
+      "Runs the output-only part of SPU2 mixing on a separate thread in blocks of 64 samples: the final core's reverb upsampling filter, effect and master volume, clamping and DC filter, and passing samples to the frontend. Voice mixing, the reverb work area and IRQ timing stay on the emulation thread and are unchanged.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_gs_threaded_uploads",
+      "System > Threaded GS Uploads",
+      "Threaded GS Uploads",
+      "Splits large image transfers into GS memory (FMV frames, texture streaming) into stripes which are swizzled on several threads. The GS thread waits for them to finish, so results are unchanged. Only helps on CPUs with spare cores.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_gpu_texture_decode",
+      "System > GPU Texture Decode (Restart)",
+      "GPU Texture Decode (Restart)",
+      "Keeps a copy of GS memory on the GPU and decodes textures from it with compute shaders, instead of unswizzling them on the CPU and uploading the result. Only used by the OpenGL (4.3 or newer) and Vulkan renderers. Palette conversion on the GPU still decodes indexed textures on the CPU.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    {
       "pcsx2_enable_cheats",
       "System > Enable Cheats",
@@ -133,6 +189,20 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      "pcsx2_guest_profiler",
+      "System > Guest Profiler",
+      "Guest Profiler",
+      "Periodically samples the EE, IOP and VU1 program counters and writes a per-function profile (collapsed stack format, for flame graphs) to the cache folder when content is closed. Adds a small amount of overhead.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    {
       "pcsx2_hint_language_unlock",
       "System > Language Unlock",
@@ -135,6 +135,11 @@ static s8 setting_trilinear_filtering          = 0;
 static bool setting_hint_nointerlacing         = false;
 static bool setting_pcrtc_antiblur             = false;
 static bool setting_enable_cheats              = false;
+static bool setting_guest_profiler             = false;
+static bool setting_ipu_thread                 = false;
+static bool setting_spu2_thread                = false;
+static bool setting_gs_threaded_uploads        = false;
+static bool setting_gpu_texture_decode         = false;
 static bool setting_enable_hw_hacks            = false;
 static bool setting_auto_flush_software        = false;
 static bool setting_disable_depth_conversion   = false;
@@ -1000,6 +1005,71 @@ static void check_variables(bool first_run)
 		}
 	}
 
+	var.key = "pcsx2_guest_profiler";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+	{
+		bool guest_profiler_prev = setting_guest_profiler;
+		setting_guest_profiler = !strcmp(var.value, "enabled");
+
+		if (first_run || setting_guest_profiler != guest_profiler_prev)
+		{
+			s_settings_interface.SetBoolValue("EmuCore", "EnableGuestProfiler", setting_guest_profiler);
+			updated = true;
+		}
+	}
+
+	var.key = "pcsx2_ipu_thread";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+	{
+		bool ipu_thread_prev = setting_ipu_thread;
+		setting_ipu_thread = !strcmp(var.value, "enabled");
+
+		if (first_run || setting_ipu_thread != ipu_thread_prev)
+		{
+			s_settings_interface.SetBoolValue("EmuCore/Speedhacks", "ipuThread", setting_ipu_thread);
+			updated = true;
+		}
+	}
+
+	var.key = "pcsx2_spu2_thread";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+	{
+		bool spu2_thread_prev = setting_spu2_thread;
+		setting_spu2_thread = !strcmp(var.value, "enabled");
+
+		if (first_run || setting_spu2_thread != spu2_thread_prev)
+		{
+			s_settings_interface.SetBoolValue("EmuCore/Speedhacks", "spu2Thread", setting_spu2_thread);
+			updated = true;
+		}
+	}
+
+	var.key = "pcsx2_gs_threaded_uploads";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+	{
+		bool gs_threaded_uploads_prev = setting_gs_threaded_uploads;
+		setting_gs_threaded_uploads = !strcmp(var.value, "enabled");
+
+		if (first_run || setting_gs_threaded_uploads != gs_threaded_uploads_prev)
+		{
+			s_settings_interface.SetBoolValue("EmuCore/GS", "ThreadedUploads", setting_gs_threaded_uploads);
+			updated = true;
+		}
+	}
+
+	var.key = "pcsx2_gpu_texture_decode";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+	{
+		bool gpu_texture_decode_prev = setting_gpu_texture_decode;
+		setting_gpu_texture_decode = !strcmp(var.value, "enabled");
+
+		if (first_run || setting_gpu_texture_decode != gpu_texture_decode_prev)
+		{
+			s_settings_interface.SetBoolValue("EmuCore/GS", "GPUTextureDecode", setting_gpu_texture_decode);
+			updated = true;
+		}
+	}
+
 	var.key = "pcsx2_hint_language_unlock";
 	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
 	{
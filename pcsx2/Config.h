@@ -473,6 +473,7 @@ struct Pcsx2Config
 
 				bool
 					GPUPaletteConversion : 1,
+					GPUTextureDecode : 1,
 					AutoFlushSW : 1,
 					PreloadFrameWithGSData : 1,
 					Mipmap : 1,
@@ -490,7 +491,9 @@ struct Pcsx2Config
 					UserHacks_EstimateTextureRegion : 1,
 					LoadTextureReplacements : 1,
 					LoadTextureReplacementsAsync : 1,
-					PrecacheTextureReplacements : 1;
+					PrecacheTextureReplacements : 1,
+					PrefetchTextureReplacements : 1,
+					ThreadedUploads : 1;
 			};
 		};
 
@@ -736,7 +739,9 @@ struct Pcsx2Config
 				     WaitLoop   : 1, // enables constant loop detection and fast-forwarding
 				     vuFlagHack : 1, // microVU specific flag hack
 				     vuThread   : 1, // Enable Threaded VU1
-				     vu1Instant : 1; // Enable Instant VU1 (Without MTVU only)
+				     vu1Instant : 1, // Enable Instant VU1 (Without MTVU only)
+				     ipuThread  : 1, // Run IDEC's IDCT and colour conversion on a worker thread
+				     spu2Thread : 1; // Run SPU2 core 1 reverb upsampling, output volume and DC filter on a worker thread
 			};
 		};
 
@@ -853,7 +858,10 @@ struct Pcsx2Config
 			     MultitapPort0_Enabled      : 1,
 			     MultitapPort1_Enabled      : 1,
 
-			     HostFs                     : 1;
+			     HostFs                     : 1,
+
+			     // Samples guest PCs from the EE event test, see DebugTools/GuestProfiler.h
+			     EnableGuestProfiler        : 1;
 
 			// uses automatic NTFS compression when creating new memory cards (Win32 only)
 		};
@@ -545,16 +545,9 @@ static __fi void rcntStartGate(bool isVblank, u32 sCycle)
 
 static __fi void VSyncStart(u32 sCycle)
 {
-	int i;
 	// Update vibration at the end of a frame.
 	DoFMVSwitch();
-	for (i = 0; i < Patch.size(); i++)
-	{
-		int _place = Patch[i].placetopatch;
-		if ( (_place == PPT_CONTINUOUSLY)
-		  || (_place == PPT_COMBINED_0_1))
-			_ApplyPatch(&Patch[i]);
-	}
+	ApplyContinuousPatches();
 
 	//These are done at VSync Start.  Drawing is done when VSync is off, then output the screen when Vsync is on
 	//The GS needs to be told at the start of a vsync else it loses half of its picture (could be responsible for some halfscreen issues)
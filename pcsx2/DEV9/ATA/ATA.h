@@ -124,6 +124,18 @@ private:
 		u64 sector;
 	};
 	SimpleQueue<WriteQueueEntry> writeQueue;
+	// Entry taken off writeQueue while coalescing that didn't follow on from the previous one.
+	WriteQueueEntry writePending{};
+	bool writePendingValid = false;
+	static constexpr u32 writeCoalesceMaxBytes = 4 * 1024 * 1024;
+
+	// Sequential read-ahead cache, filled by the IO thread between read commands.
+	// Only accessed from the IO thread, or from HDD_ReadSync() while the IO thread is idle.
+	static constexpr u32 readAheadMaxSectors = 512;
+	std::unique_ptr<u8[]> readAheadBuffer;
+	u64 readAheadStart = 0;
+	u32 readAheadCount = 0;
+	u64 readNextSector = ~0ULL;
 
 	std::thread ioThread;
 	bool ioRunning = false;
@@ -136,6 +148,7 @@ private:
 	std::atomic_bool ioClose{false};
 	bool ioWrite;
 	bool ioRead;
+	bool ioReadAhead = false;
 	void (ATA::*waitingCmd)() = nullptr;
 	//Write Buffer(s)
 
@@ -219,6 +232,9 @@ private:
 	//Transfer
 	void IO_Thread();
 	void IO_Read();
+	void IO_ReadAt(u8* buffer, u64 pos, u64 length);
+	void IO_ReadAhead();
+	bool IO_NextWrite(WriteQueueEntry* entry);
 	bool IO_Write();
 	bool IO_SparseZero(u64 byteOffset, u64 byteSize);
 	void IO_SparseCacheUpdateLocation(u64 Offset);
@@ -77,8 +77,13 @@ int ATA::Open(const std::string& hddPath)
 		std::lock_guard ioSignallock(ioMutex);
 		ioRead = false;
 		ioWrite = false;
+		ioReadAhead = false;
 	}
 
+	readAheadBuffer = std::make_unique<u8[]>(readAheadMaxSectors * 512);
+	readAheadCount = 0;
+	readNextSector = ~0ULL;
+
 	ioThread = std::thread(&ATA::IO_Thread, this);
 	ioRunning = true;
 
@@ -261,6 +266,9 @@ void ATA::Close()
 
 	delete[] readBuffer;
 	readBuffer = nullptr;
+
+	readAheadBuffer = nullptr;
+	readAheadCount = 0;
 }
 
 void ATA::ResetBegin()
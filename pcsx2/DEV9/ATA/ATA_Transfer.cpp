@@ -15,6 +15,8 @@
 
 #include "common/FileSystem.h"
 
+#include <vector>
+
 #include "ATA.h"
 #include "DEV9/DEV9.h"
 
@@ -36,20 +38,28 @@ void ATA::IO_Thread()
 		ioThreadIdle_bool = true;
 		ioThreadIdle_cv.notify_all();
 
-		ioReady.wait(ioWaitHandle, [&] { return ioRead | ioWrite; });
+		ioReady.wait(ioWaitHandle, [&] { return ioRead | ioWrite | ioReadAhead; });
 		ioThreadIdle_bool = false;
 
+		//Prefetching comes before writes, as the game is likely waiting on the next read
 		int ioType = -1;
 		if (ioRead)
 			ioType = 0;
+		else if (ioReadAhead)
+			ioType = 2;
 		else if (ioWrite)
 			ioType = 1;
 
+		if (ioType == 2)
+			ioReadAhead = false;
+
 		ioWaitHandle.unlock();
 
 		//Read or Write
 		if (ioType == 0)
 			IO_Read();
+		else if (ioType == 2)
+			IO_ReadAhead();
 		else if (ioType == 1)
 		{
 			if (!IO_Write())
@@ -77,29 +87,123 @@ void ATA::IO_Read()
 		abort();
 	}
 
-	const u64 pos = lba * 512;
+	const u64 sector = static_cast<u64>(lba);
+	if (readAheadCount != 0 && sector >= readAheadStart &&
+		sector + nsector <= readAheadStart + readAheadCount)
+	{
+		//Already prefetched
+		memcpy(readBuffer, &readAheadBuffer[(sector - readAheadStart) * 512], nsector * 512);
+	}
+	else
+		IO_ReadAt(readBuffer, sector * 512, static_cast<u64>(nsector) * 512);
+
+	readNextSector = sector + nsector;
+	{
+		std::lock_guard ioSignallock(ioMutex);
+		ioRead = false;
+	}
+}
+
+void ATA::IO_ReadAt(u8* buffer, u64 pos, u64 length)
+{
+#if defined(__POSIX__)
+	//Positional read, leaves the FILE* position (used by writes) alone
+	const int fd = fileno(hddImage);
+	u64 done = 0;
+	while (done < length)
+	{
+		const ssize_t ret = pread(fd, buffer + done, length - done, static_cast<off_t>(pos + done));
+		if (ret <= 0)
+		{
+			Console.Error("DEV9: ATA: File read error");
+			abort();
+		}
+		done += static_cast<u64>(ret);
+	}
+#else
 	if (FileSystem::FSeek64(hddImage, pos, SEEK_SET) != 0 ||
-		std::fread(readBuffer,  512, nsector, hddImage) != static_cast<size_t>(nsector))
+		std::fread(buffer, length, 1, hddImage) != 1)
 	{
 		Console.Error("DEV9: ATA: File read error");
 		abort();
 	}
+#endif
+}
+
+void ATA::IO_ReadAhead()
+{
+	const u64 imageSectors = hddImageSize / 512;
+	const u64 start = readNextSector;
+	if (start >= imageSectors)
+		return;
+
+	const u32 count = static_cast<u32>(std::min<u64>(readAheadMaxSectors, imageSectors - start));
+	if (readAheadCount != 0 && start >= readAheadStart && start + count <= readAheadStart + readAheadCount)
+		return;
+
+	readAheadCount = 0;
+	IO_ReadAt(readAheadBuffer.get(), start * 512, static_cast<u64>(count) * 512);
+	readAheadStart = start;
+	readAheadCount = count;
+}
+
+bool ATA::IO_NextWrite(WriteQueueEntry* entry)
+{
+	if (writePendingValid)
 	{
-		std::lock_guard ioSignallock(ioMutex);
-		ioRead = false;
+		*entry = writePending;
+		writePendingValid = false;
+		return true;
 	}
+	return writeQueue.Dequeue(entry);
 }
 
 bool ATA::IO_Write()
 {
 	WriteQueueEntry entry;
-	if (!writeQueue.Dequeue(&entry))
+	if (!IO_NextWrite(&entry))
 	{
 		std::lock_guard ioSignallock(ioMutex);
 		ioWrite = false;
 		return false;
 	}
 
+	//Coalesce queued writes that continue on from this one into a single file write
+	WriteQueueEntry next;
+	std::vector<WriteQueueEntry> run;
+	u32 runLength = entry.length;
+	while (runLength < writeCoalesceMaxBytes && IO_NextWrite(&next))
+	{
+		if (next.sector != entry.sector + runLength / 512)
+		{
+			writePending = next;
+			writePendingValid = true;
+			break;
+		}
+		if (run.empty())
+			run.push_back(entry);
+		run.push_back(next);
+		runLength += next.length;
+	}
+	if (!run.empty())
+	{
+		entry.data = new u8[runLength];
+		entry.length = runLength;
+		u32 offset = 0;
+		for (const WriteQueueEntry& part : run)
+		{
+			memcpy(&entry.data[offset], part.data, part.length);
+			offset += part.length;
+			delete[] part.data;
+		}
+	}
+
+	//Drop any prefetched sectors this write overlaps
+	const u64 writeSectors = entry.length / 512;
+	if (readAheadCount != 0 && entry.sector < readAheadStart + readAheadCount &&
+		readAheadStart < entry.sector + writeSectors)
+		readAheadCount = 0;
+
 	u64 imagePos = entry.sector * 512;
 	if (FileSystem::FSeek64(hddImage, imagePos, SEEK_SET) != 0)
 	{
@@ -356,6 +460,8 @@ void ATA::HDD_ReadSync(void (ATA::*drqCMD)())
 	//Set ioWrite false to prevent reading & writing at the same time
 	const bool ioWritePaused = ioWrite;
 	ioWrite = false;
+	//A prefetch that hasn't started yet is dropped, one that has is waited on below
+	ioReadAhead = false;
 
 	//wait until thread waiting
 	ioThreadIdle_cv.wait(ioWaitHandle, [&] { return ioThreadIdle_bool; });
@@ -385,13 +491,12 @@ void ATA::HDD_ReadSync(void (ATA::*drqCMD)())
 
 	IO_Read();
 
-	if (ioWritePaused)
-	{
-		ioWaitHandle.lock();
-		ioWrite = true;
-		ioWaitHandle.unlock();
-		ioReady.notify_all();
-	}
+	//Prefetch what follows while the game handles this read
+	ioWaitHandle.lock();
+	ioWrite = ioWritePaused;
+	ioReadAhead = true;
+	ioWaitHandle.unlock();
+	ioReady.notify_all();
 
 	(this->*drqCMD)();
 }
@@ -0,0 +1,110 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GuestProfiler.h"
+#include "SymbolMap.h"
+
+#include "Common.h"
+#include "R3000A.h"
+#include "VU.h"
+
+#include "common/Console.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+// Roughly 9kHz on a full speed EE, which keeps the cost to a hash map
+// increment every few event tests.
+static constexpr u32 SAMPLE_INTERVAL = 0x8000;
+
+static u32 s_last_sample_cycle = 0;
+static u32 s_sample_count = 0;
+static std::unordered_map<u32, u32> s_ee_samples;
+static std::unordered_map<u32, u32> s_iop_samples;
+static std::unordered_map<u32, u32> s_vu1_samples;
+
+void GuestProfiler::Sample()
+{
+	if ((cpuRegs.cycle - s_last_sample_cycle) < SAMPLE_INTERVAL)
+		return;
+
+	s_last_sample_cycle = cpuRegs.cycle;
+	s_sample_count++;
+
+	s_ee_samples[cpuRegs.pc]++;
+	s_iop_samples[psxRegs.pc]++;
+
+	// Only count VU1 while a microprogram is running, otherwise idle time
+	// would pile up on the last TPC.
+	if (vuRegs[0].VI[REG_VPU_STAT].UL & 0x100)
+		s_vu1_samples[vuRegs[1].VI[REG_TPC].UL]++;
+}
+
+static std::string GetFunctionName(const SymbolMap& map, u32 pc)
+{
+	const u32 start = map.GetFunctionStart(pc);
+	if (start == SymbolMap::INVALID_ADDRESS)
+		return fmt::format("{:08x}", pc & ~0xFFu);
+
+	std::string name = map.GetLabelName(start);
+	if (!name.empty())
+		return name;
+
+	return fmt::format("sub_{:08x}", start);
+}
+
+static void AggregateSamples(std::map<std::string, u32>& stacks, const char* cpu,
+	const std::unordered_map<u32, u32>& samples, const SymbolMap* map)
+{
+	for (const auto& [pc, count] : samples)
+	{
+		const std::string func = map ? GetFunctionName(*map, pc) : fmt::format("{:04x}", pc);
+		stacks[fmt::format("{};{}", cpu, func)] += count;
+	}
+}
+
+void GuestProfiler::Dump(const std::string& serial)
+{
+	if (s_sample_count == 0)
+		return;
+
+	std::map<std::string, u32> stacks;
+	AggregateSamples(stacks, "EE", s_ee_samples, &R5900SymbolMap);
+	AggregateSamples(stacks, "IOP", s_iop_samples, &R3000SymbolMap);
+	AggregateSamples(stacks, "VU1", s_vu1_samples, nullptr);
+
+	const std::string path = Path::Combine(EmuFolders::Cache,
+		fmt::format("{}_profile.folded", serial.empty() ? std::string("unknown") : serial));
+
+	std::string out;
+	for (const auto& [stack, count] : stacks)
+		out += fmt::format("{} {}\n", stack, count);
+
+	if (FileSystem::WriteBinaryFile(path.c_str(), out.data(), out.size()))
+		Console.WriteLn("(GuestProfiler) Wrote %u samples to %s", s_sample_count, path.c_str());
+	else
+		Console.Error("(GuestProfiler) Failed to write %s", path.c_str());
+
+	s_sample_count = 0;
+	s_ee_samples.clear();
+	s_iop_samples.clear();
+	s_vu1_samples.clear();
+}
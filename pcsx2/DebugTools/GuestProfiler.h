@@ -0,0 +1,31 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+
+// Sampling profiler for guest code. While EmuConfig.EnableGuestProfiler is set,
+// the EE event test records the EE, IOP and VU1 program counters at a fixed
+// EE cycle interval. The samples are grouped by function through the symbol
+// maps and written in collapsed-stack format (flamegraph.pl, speedscope).
+namespace GuestProfiler
+{
+	/// Records one sample if the sampling interval has elapsed. EE thread only.
+	void Sample();
+
+	/// Writes the collected samples to the cache folder and clears them.
+	void Dump(const std::string& serial);
+} // namespace GuestProfiler
@@ -367,6 +367,17 @@ void SymbolMap::AddLabel(const char* name, u32 address, int moduleIndex)
 	}
 }
 
+std::string SymbolMap::GetLabelName(u32 address) const
+{
+	std::lock_guard<std::recursive_mutex> guard(m_lock);
+	auto it = activeLabels.find(address);
+	if (it == activeLabels.end())
+		return std::string();
+
+	// Copied under the lock, the debugger can replace or clear labels at any time.
+	return it->second.name;
+}
+
 void SymbolMap::AddData(u32 address, u32 size, DataType type, int moduleIndex)
 {
 	std::lock_guard<std::recursive_mutex> guard(m_lock);
@@ -13,12 +13,17 @@
  *  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #include <unordered_set>
 
 #include "GS.h"
 #include "GSLocalMemory.h"
 #include "GSExtra.h"
 
+#include "common/Threading.h"
+
 template <typename Fn>
 static void foreachBlock(const GSOffset& off, GSLocalMemory* mem, const GSVector4i& r, u8* dst, int dstpitch, int bpp, Fn&& fn)
 {
@@ -241,8 +246,95 @@ GSLocalMemory::GSLocalMemory()
 	m_psm[PSMZ16S].fmsk = 0x80F8F8F8;
 }
 
+struct GSLocalMemory::UploadThreads
+{
+	static constexpr int MAX_THREADS = 3;
+
+	struct Worker
+	{
+		Threading::Thread thread;
+		Threading::WorkSema sema;
+	};
+
+	std::array<Worker, MAX_THREADS> workers;
+	int count = 0;
+	std::atomic<bool> exit{false};
+
+	void (*func)(const void*, int) = nullptr;
+	const void* param = nullptr;
+	std::atomic<int> next{0};
+	int total = 0;
+
+	UploadThreads()
+	{
+		// Leave room for the EE, VU and GS threads.
+		count = std::clamp(static_cast<int>(std::thread::hardware_concurrency()) / 2 - 1, 1, MAX_THREADS);
+
+		for (int i = 0; i < count; i++)
+		{
+			Worker& w = workers[i];
+			w.thread.Start([this, &w]() {
+				for (;;)
+				{
+					w.sema.WaitForWork();
+					if (exit.load(std::memory_order_acquire))
+						break;
+					Run();
+				}
+			});
+		}
+	}
+
+	~UploadThreads()
+	{
+		exit.store(true, std::memory_order_release);
+		for (int i = 0; i < count; i++)
+		{
+			workers[i].sema.NotifyOfWork();
+			workers[i].thread.Join();
+		}
+	}
+
+	void Run()
+	{
+		for (int i; (i = next.fetch_add(1, std::memory_order_relaxed)) < total;)
+			func(param, i);
+	}
+};
+
+void GSLocalMemory::ParallelUpload(int count, void (*func)(const void* param, int i), const void* param)
+{
+	if (count > 1 && GSConfig.ThreadedUploads)
+	{
+		if (!m_upload_threads)
+			m_upload_threads = std::make_unique<UploadThreads>();
+
+		UploadThreads& ut = *m_upload_threads;
+		ut.func = func;
+		ut.param = param;
+		ut.total = count;
+		ut.next.store(0, std::memory_order_release);
+
+		const int workers = std::min(ut.count, count - 1);
+		for (int i = 0; i < workers; i++)
+			ut.workers[i].sema.NotifyOfWork();
+
+		ut.Run();
+
+		for (int i = 0; i < workers; i++)
+			ut.workers[i].sema.WaitForEmpty();
+	}
+	else
+	{
+		for (int i = 0; i < count; i++)
+			func(param, i);
+	}
+}
+
 GSLocalMemory::~GSLocalMemory()
 {
+	m_upload_threads.reset();
+
 	if (m_vm8)
 		GSFreeWrappedMemory(m_vm8, m_vmsize, 4);
 
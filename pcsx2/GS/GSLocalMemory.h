@@ -20,6 +20,7 @@
 #include "GSClut.h"
 #include "MultiISA.h"
 #include <array>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -510,10 +511,17 @@ protected:
 	std::unordered_map<u32, GSPixelOffset4*> m_po4map;
 	std::unordered_map<u64, std::vector<GSVector2i>*> m_p2tmap;
 
+	struct UploadThreads;
+	std::unique_ptr<UploadThreads> m_upload_threads;
+
 public:
 	GSLocalMemory();
 	~GSLocalMemory();
 
+	/// Runs func(param, i) for i in [0, count) on the upload threads (GSConfig.ThreadedUploads) and
+	/// the calling thread, returning once every call has finished. The calls must not overlap in memory.
+	void ParallelUpload(int count, void (*func)(const void* param, int i), const void* param);
+
 	__forceinline u8* vm8() const { return m_vm8; }
 	__forceinline u16* vm16() const { return reinterpret_cast<u16*>(m_vm8); }
 	__forceinline u32* vm32() const { return reinterpret_cast<u32*>(m_vm8); }
@@ -28,6 +28,12 @@ class CURRENT_ISA::GSLocalMemoryFunctions
 	template <int psm, int bsx, int bsy, int alignment>
 	static void WriteImageBlock(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
 
+	template <int psm, int bsx, int bsy, int trbpp>
+	static void WriteImageBlockAligned(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
+
+	template <int psm, int bsx, int bsy, int trbpp>
+	static void WriteImageBlockThreaded(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
+
 	template <int psm, int bsx, int bsy>
 	static void WriteImageLeftRight(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF);
 
@@ -277,6 +283,70 @@ void GSLocalMemoryFunctions::WriteImageBlock(GSLocalMemory& mem, int l, int r, i
 	}
 }
 
+template <int psm, int bsx, int bsy, int trbpp>
+void GSLocalMemoryFunctions::WriteImageBlockAligned(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
+{
+#if FAST_UNALIGNED
+	WriteImageBlock<psm, bsx, bsy, 0>(mem, l, r, y, h, src, srcpitch, BITBLTBUF);
+#else
+	size_t addr = (size_t)&src[l * trbpp >> 3];
+
+	if ((addr & 31) == 0 && (srcpitch & 31) == 0)
+	{
+		WriteImageBlock<psm, bsx, bsy, 32>(mem, l, r, y, h, src, srcpitch, BITBLTBUF);
+	}
+	else if ((addr & 15) == 0 && (srcpitch & 15) == 0)
+	{
+		WriteImageBlock<psm, bsx, bsy, 16>(mem, l, r, y, h, src, srcpitch, BITBLTBUF);
+	}
+	else
+	{
+		WriteImageBlock<psm, bsx, bsy, 0>(mem, l, r, y, h, src, srcpitch, BITBLTBUF);
+	}
+#endif
+}
+
+template <int psm, int bsx, int bsy, int trbpp>
+void GSLocalMemoryFunctions::WriteImageBlockThreaded(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
+{
+	// Splits the block aligned part of a big transfer (FMV frames, texture streaming) into
+	// stripes of block rows, which are swizzled in parallel. Every stripe has to land on its
+	// own blocks, so the destination must not wrap around the buffer width or the end of memory.
+
+	constexpr int MIN_PIXELS = 256 * 128;
+	constexpr int MAX_STRIPES = 16;
+
+	const GSVector2i& pgs = GSLocalMemory::m_psm[psm].pgs;
+	const int page_row_width = (static_cast<int>(BITBLTBUF.DBW) * 64 / pgs.x) * pgs.x;
+	const u32 end_block = BITBLTBUF.DBP + static_cast<u32>((y + h + pgs.y - 1) / pgs.y) * (page_row_width / pgs.x) * 32;
+
+	if (!GSConfig.ThreadedUploads || (r - l) * h < MIN_PIXELS || r > page_row_width || end_block > MAX_BLOCKS)
+	{
+		WriteImageBlockAligned<psm, bsx, bsy, trbpp>(mem, l, r, y, h, src, srcpitch, BITBLTBUF);
+		return;
+	}
+
+	struct Stripes
+	{
+		GSLocalMemory* mem;
+		const GIFRegBITBLTBUF* BITBLTBUF;
+		const u8* src;
+		int srcpitch;
+		int l, r, y;
+		int block_rows, count;
+	};
+
+	const int block_rows = h / bsy;
+	const Stripes stripes = {&mem, &BITBLTBUF, src, srcpitch, l, r, y, block_rows, std::min(block_rows, MAX_STRIPES)};
+
+	mem.ParallelUpload(stripes.count, [](const void* param, int i) {
+		const Stripes& s = *static_cast<const Stripes*>(param);
+		const int start = s.block_rows * i / s.count * bsy;
+		const int end = s.block_rows * (i + 1) / s.count * bsy;
+		WriteImageBlockAligned<psm, bsx, bsy, trbpp>(*s.mem, s.l, s.r, s.y + start, end - start, s.src + s.srcpitch * start, s.srcpitch, *s.BITBLTBUF);
+	}, &stripes);
+}
+
 template <int psm, int bsx, int bsy>
 void GSLocalMemoryFunctions::WriteImageLeftRight(GSLocalMemory& mem, int l, int r, int y, int h, const u8* src, int srcpitch, const GIFRegBITBLTBUF& BITBLTBUF)
 {
@@ -561,24 +631,7 @@ void GSLocalMemoryFunctions::WriteImage(GSLocalMemory& mem, int& tx, int& ty, co
 
 				if (h2 > 0)
 				{
-#if FAST_UNALIGNED
-					WriteImageBlock<psm, bsx, bsy, 0>(mem, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
-#else
-					size_t addr = (size_t)&s[la * trbpp >> 3];
-
-					if ((addr & 31) == 0 && (srcpitch & 31) == 0)
-					{
-						WriteImageBlock<psm, bsx, bsy, 32>(mem, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
-					}
-					else if ((addr & 15) == 0 && (srcpitch & 15) == 0)
-					{
-						WriteImageBlock<psm, bsx, bsy, 16>(mem, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
-					}
-					else
-					{
-						WriteImageBlock<psm, bsx, bsy, 0>(mem, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
-					}
-#endif
+					WriteImageBlockThreaded<psm, bsx, bsy, trbpp>(mem, la, ra, ty, h2, s, srcpitch, BITBLTBUF);
 
 					s += srcpitch * h2;
 					ty += h2;
@@ -921,6 +974,79 @@ void GSLocalMemoryFunctions::WriteImageX(GSLocalMemory& mem, int& tx, int& ty, c
 
 //
 
+/// Reads PSMT8H/4HL/4HH pixels from the top bits of the 32-bit words, a column (8 pixels) at a time where aligned.
+/// Nibble formats read two pixels per byte, so tx, sx and w must be even.
+template <u32 shift, u32 mask, bool nibbles>
+static void ReadImageXH(const GSLocalMemory& mem, int& tx, int& ty, u8* RESTRICT pb, int len, int sx, int w, const GSOffset& off)
+{
+	constexpr int step = nibbles ? 2 : 1;
+
+	const u32* vm = mem.vm32();
+
+	int x = tx;
+	int y = ty;
+	int ex = sx + w;
+	int n = nibbles ? len * 2 : len;
+
+	GSOffset::PAHelper pa = off.paMulti(0, y);
+
+	const auto read = [&](int x) {
+		const u8 c = static_cast<u8>((vm[pa.value(x)] >> shift) & mask);
+		*pb++ = nibbles ? static_cast<u8>(c | (((vm[pa.value(x + 1)] >> shift) & mask) << 4)) : c;
+	};
+
+	while (n > 0)
+	{
+		for (; n > 0 && x < ex && (x & 7); n -= step, x += step)
+			read(x);
+
+		// aligned to a column
+
+		for (int ex8 = ex - 8; n >= 8 && x <= ex8; n -= 8, x += 8)
+		{
+			const u32* ps = &vm[pa.value(x)];
+
+			GSVector4i v0 = GSVector4i::load(ps + 0, ps + 4).srl32<shift>();
+			GSVector4i v1 = GSVector4i::load(ps + 8, ps + 12).srl32<shift>();
+
+			if (mask != 0xff)
+			{
+				v0 = v0 & GSVector4i(mask);
+				v1 = v1 & GSVector4i(mask);
+			}
+
+			GSVector4i v = v0.pu32(v1);
+
+			if (nibbles)
+			{
+				v = (v | v.srl32<12>()) & GSVector4i::x000000ff();
+				v = v.pu32().pu16();
+
+				*reinterpret_cast<u32*>(pb) = static_cast<u32>(GSVector4i::store(v));
+				pb += 4;
+			}
+			else
+			{
+				GSVector4i::storel(pb, v.pu16());
+				pb += 8;
+			}
+		}
+
+		for (; n > 0 && x < ex; n -= step, x += step)
+			read(x);
+
+		if (x == ex)
+		{
+			y++;
+			x = sx;
+			pa = off.paMulti(0, y);
+		}
+	}
+
+	tx = x;
+	ty = y;
+}
+
 void GSLocalMemoryFunctions::ReadImageX(const GSLocalMemory& mem, int& tx, int& ty, u8* dst, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG)
 {
 	if (len <= 0)
@@ -1028,14 +1154,16 @@ void GSLocalMemoryFunctions::ReadImageX(const GSLocalMemory& mem, int& tx, int&
 			break;
 
 		case PSMT8H:
-			readWriteHelper(tx, ty, len, 1, sx, w, GSOffset::fromKnownPSM(bp, bw, PSMT8H), [&](GSOffset::PAHelper& pa, int x)
-			{
-				*pb = (u8)(vm32[pa.value(x)] >> 24);
-				pb++;
-			});
+			ReadImageXH<24, 0xff, false>(mem, tx, ty, pb, len, sx, w, GSOffset::fromKnownPSM(bp, bw, PSMT8H));
 			break;
 
 		case PSMT4HL:
+			if (((tx | sx | w) & 1) == 0)
+			{
+				ReadImageXH<24, 0x0f, true>(mem, tx, ty, pb, len, sx, w, GSOffset::fromKnownPSM(bp, bw, PSMT4HL));
+				break;
+			}
+
 			readWriteHelper(tx, ty, len * 2, 2, sx, w, GSOffset::fromKnownPSM(bp, bw, PSMT4HL), [&](GSOffset::PAHelper& pa, int x)
 			{
 				u32 c0 = vm32[pa.value(x)] >> 24 & 0x0f;
@@ -1046,6 +1174,12 @@ void GSLocalMemoryFunctions::ReadImageX(const GSLocalMemory& mem, int& tx, int&
 			break;
 
 		case PSMT4HH:
+			if (((tx | sx | w) & 1) == 0)
+			{
+				ReadImageXH<28, 0x0f, true>(mem, tx, ty, pb, len, sx, w, GSOffset::fromKnownPSM(bp, bw, PSMT4HH));
+				break;
+			}
+
 			readWriteHelper(tx, ty, len * 2, 2, sx, w, GSOffset::fromKnownPSM(bp, bw, PSMT4HH), [&](GSOffset::PAHelper& pa, int x)
 			{
 				u32 c0 = vm32[pa.value(x)] >> 28 & 0x0f;
@@ -83,6 +83,10 @@ enum GIF_REG_COMPLEX
 {
 	GIF_REG_STQRGBAXYZF2 = 0x00,
 	GIF_REG_STQRGBAXYZ2 = 0x01,
+	GIF_REG_UVRGBAXYZF2 = 0x02,
+	GIF_REG_UVRGBAXYZ2 = 0x03,
+	GIF_REG_RGBAXYZF2 = 0x04,
+	GIF_REG_RGBAXYZ2 = 0x05,
 };
 
 enum GIF_A_D_REG
@@ -1123,7 +1127,11 @@ struct alignas(32) GIFPath
 		TYPE_UNKNOWN,
 		TYPE_ADONLY,
 		TYPE_STQRGBAXYZF2,
-		TYPE_STQRGBAXYZ2
+		TYPE_STQRGBAXYZ2,
+		TYPE_UVRGBAXYZF2,
+		TYPE_UVRGBAXYZ2,
+		TYPE_RGBAXYZF2,
+		TYPE_RGBAXYZ2
 	};
 
 	__forceinline void SetTag(const void* mem)
@@ -1161,6 +1169,13 @@ struct alignas(32) GIFPath
 			{
 				switch (nreg)
 				{
+					case 2:
+						// untextured
+						if (regs.U32[0] == 0x00000401)
+							type = TYPE_RGBAXYZF2;
+						if (regs.U32[0] == 0x00000501)
+							type = TYPE_RGBAXYZ2;
+						break;
 					case 3:
 						// many games, TODO: formats mixed with NOPs (xeno2: 040f010f02, 04010f020f, mgs3: 04010f0f02, 0401020f0f, 04010f020f)
 						if (regs.U32[0] == 0x00040102)
@@ -1168,7 +1183,26 @@ struct alignas(32) GIFPath
 						// GoW (has other crazy formats, like ...030503050103)
 						if (regs.U32[0] == 0x00050102)
 							type = TYPE_STQRGBAXYZ2;
-						// TODO: common types with UV instead
+						// sprites and 2D draws with FST
+						if (regs.U32[0] == 0x00040103)
+							type = TYPE_UVRGBAXYZF2;
+						if (regs.U32[0] == 0x00050103)
+							type = TYPE_UVRGBAXYZ2;
+						break;
+					case 6:
+						// two vertices per loop
+						if (regs.U32[0] == 0x02040102 && regs.U32[1] == 0x00000401)
+						{
+							type = TYPE_STQRGBAXYZF2;
+							nreg = 3;
+							nloop *= 2;
+						}
+						if (regs.U32[0] == 0x02050102 && regs.U32[1] == 0x00000501)
+						{
+							type = TYPE_STQRGBAXYZ2;
+							nreg = 3;
+							nloop *= 2;
+						}
 						break;
 					case 9:
 						// ffx
@@ -1189,10 +1223,8 @@ struct alignas(32) GIFPath
 						}
 						break;
 					case 1:
-					case 2:
 					case 4:
 					case 5:
-					case 6:
 					case 7:
 					case 8:
 					case 10:
@@ -46,15 +46,28 @@ struct GSRingHeap::Buffer
 
 	static constexpr size_t USAGE_ARR_SIZE = sizeof(uint64_t) / sizeof(size_t);
 	static constexpr size_t USAGE_ARR_ELEMS_PER_ENTRY = sizeof(size_t) / sizeof(uint16_t);
+	/// Number of allocations the producer reserves on a quadrant's usage counter at once
+	static constexpr size_t USAGE_CREDIT = 256;
+	/// Number of frees a thread batches up before handing them back
+	static constexpr uint32_t MAX_PENDING_FREES = 64;
+
+	/// Frees from one thread that haven't been handed back to their buffer yet
+	/// They're all from the same buffer and start in the same quadrant, since frees arrive in roughly
+	///   allocation order that covers runs of frees until the thread moves on to the next quadrant
+	struct PendingFrees
+	{
+		Buffer* buffer = nullptr;
+		uint32_t quadrant = 0;
+		uint32_t count = 0;
+		/// Sum of the usage masks, each quadrant's 16-bit count can't overflow with `MAX_PENDING_FREES`
+		uint64_t usage = 0;
+		size_t amt = 0;
+	};
+	static thread_local PendingFrees s_pending_frees;
+
+	// Producer-only state. Kept on its own cache line so frees from the rasterizer threads
+	//   don't keep stealing it from the thread doing the allocating.
 
-	/// Refcount, main heap holds onto buffer with a +1
-	/// Each allocation adds `sizeof(allocation)`, to allow for detection of buffers being used inefficiently
-	///   (e.g. if a buffer is orphaned with very little usage that means allocations aren't being freed in a similar order to being made)
-	/// Buffer is freed when the main heap drops it (-1) and every allocation is freed, causing this to reach 0
-	std::atomic<size_t> m_amt_allocated;
-	/// Holds 4x 16-bit usage counters, indicating how many allocations have been made from the nth quadrant of memory
-	/// Merged into `size_t` chunks so that they can be operated on with fewer atomic operations
-	std::atomic<size_t> m_usage[USAGE_ARR_SIZE];
 	/// Size of whole buffer (including header)
 	/// Should be kept to at least 2x the largest allocation
 	size_t m_size;
@@ -62,6 +75,19 @@ struct GSRingHeap::Buffer
 	size_t m_write_loc;
 	/// Amount to rshift buffer offset to get which quadrant it's in (`log2(m_size/4)`)
 	int m_quadrant_shift;
+	/// Usage count already added to the quadrant of `m_write_loc - 1` that allocations entirely inside it can use up
+	///   without touching `m_usage`. Handed back when the write location leaves the quadrant.
+	size_t m_usage_credit;
+	/// Bytes already added to `m_amt_allocated` that allocations can use up without touching it
+	size_t m_amt_credit;
+
+	/// Refcount, main heap holds onto buffer with a +1 (plus whatever is left of `m_amt_credit`)
+	/// Each allocation adds `sizeof(allocation)`
+	/// Buffer is freed when the main heap drops it (-1) and every allocation is freed, causing this to reach 0
+	alignas(64) std::atomic<size_t> m_amt_allocated;
+	/// Holds 4x 16-bit usage counters, indicating how many allocations have been made from the nth quadrant of memory
+	/// Merged into `size_t` chunks so that they can be operated on with fewer atomic operations
+	std::atomic<size_t> m_usage[USAGE_ARR_SIZE];
 
 	/// Increment usage counts (use when allocating)
 	void beginUse(uint64_t usage)
@@ -69,7 +95,8 @@ struct GSRingHeap::Buffer
 		for (size_t i = 0; i < USAGE_ARR_SIZE; i++)
 		{
 			size_t piece = static_cast<size_t>(usage >> (i * (64 / USAGE_ARR_SIZE)));
-			m_usage[i].fetch_add(piece, std::memory_order_relaxed);
+			if (piece)
+				m_usage[i].fetch_add(piece, std::memory_order_relaxed);
 		}
 	}
 
@@ -79,7 +106,8 @@ struct GSRingHeap::Buffer
 		for (size_t i = 0; i < USAGE_ARR_SIZE; i++)
 		{
 			size_t piece = static_cast<size_t>(usage >> (i * (64 / USAGE_ARR_SIZE)));
-			m_usage[i].fetch_sub(piece, std::memory_order_release);
+			if (piece)
+				m_usage[i].fetch_sub(piece, std::memory_order_release);
 		}
 	}
 
@@ -110,6 +138,28 @@ struct GSRingHeap::Buffer
 		return mask;
 	}
 
+	/// Give back the usage reserved on the quadrant we're leaving, so it can drain to zero
+	void releaseUsageCredit()
+	{
+		if (m_usage_credit)
+		{
+			endUse(static_cast<uint64_t>(m_usage_credit) << (quadrant(m_write_loc - 1) * 16));
+			m_usage_credit = 0;
+		}
+	}
+
+	/// Account `amt` bytes against `m_amt_allocated`, topping up the local credit in large steps
+	void consumeAmt(size_t amt)
+	{
+		if (unlikely(m_amt_credit < amt))
+		{
+			size_t top_up = std::max(amt, m_size / 4);
+			m_amt_allocated.fetch_add(top_up, std::memory_order_relaxed);
+			m_amt_credit += top_up;
+		}
+		m_amt_credit -= amt;
+	}
+
 	/// Decrement the main amt_allocated refcount
 	void decref(size_t amt)
 	{
@@ -120,13 +170,48 @@ struct GSRingHeap::Buffer
 		}
 	}
 
+	/// Drop the main heap's reference (and any credit it was holding)
+	void orphan()
+	{
+		decref(m_amt_credit + 1);
+	}
+
+	/// Release this thread's batched frees with one usage decrement and one decref
+	static void flushPendingFrees()
+	{
+		PendingFrees& pending = s_pending_frees;
+		if (!pending.buffer)
+			return;
+
+		Buffer* buffer = pending.buffer;
+		const uint64_t usage = pending.usage;
+		const size_t amt = pending.amt;
+		pending = {};
+
+		buffer->endUse(usage);
+		buffer->decref(amt);
+	}
+
 	/// Free an allocation
+	/// The release is batched with this thread's other frees from the same quadrant, which keep the buffer alive
 	void free(void* allocation, size_t size)
 	{
 		const char* base = reinterpret_cast<const char*>(this);
 		size_t begin_off = static_cast<const char*>(allocation) - base;
-		endUse(usageMask(begin_off, size));
-		decref(size);
+		uint32_t begin_quadrant = quadrant(begin_off);
+
+		PendingFrees& pending = s_pending_frees;
+		if (pending.buffer != this || pending.quadrant != begin_quadrant || pending.count == MAX_PENDING_FREES)
+		{
+			// This allocation still holds its bytes, so flushing can't drop `this` to zero
+			flushPendingFrees();
+			pending.buffer = this;
+			pending.quadrant = begin_quadrant;
+		}
+
+		pending.usage += usageMask(begin_off, size);
+		pending.amt += size;
+		pending.count++;
 	}
 
 	/// Allocate a value of `size` bytes with `prefix_size` bytes before it (for allocation tracking) and alignment specified by `align_mask`
@@ -134,10 +219,23 @@ struct GSRingHeap::Buffer
 	{
 		uint32_t prev_quadrant = quadrant(m_write_loc - 1);
 		size_t base_off = alignUsingMask(align_mask, m_write_loc + prefix_size);
-		uint64_t usage_mask = 1ull << (quadrant(base_off - prefix_size) * 16);
 		uint32_t new_quadrant = quadrant(base_off + size - 1);
-		if (prev_quadrant != new_quadrant)
+		if (likely(prev_quadrant == new_quadrant))
+		{
+			// Entirely inside the quadrant we're already writing to, which nobody else checks
+			if (unlikely(m_usage_credit == 0))
+			{
+				beginUse(static_cast<uint64_t>(USAGE_CREDIT) << (prev_quadrant * 16));
+				m_usage_credit = USAGE_CREDIT;
+			}
+			m_usage_credit--;
+		}
+		else
 		{
+			// Our own batched frees could be what's keeping the next quadrant busy
+			flushPendingFrees();
+			releaseUsageCredit();
+			uint64_t usage_mask = 1ull << (quadrant(base_off - prefix_size) * 16);
 			uint32_t cur_quadrant = prev_quadrant + 1;
 			if (new_quadrant >= 4)
 			{
@@ -152,20 +250,22 @@ struct GSRingHeap::Buffer
 				if (unlikely(isStillInUse(cur_quadrant)))
 					return nullptr;
 			} while (++cur_quadrant <= new_quadrant);
+			beginUse(usage_mask);
 		}
 
 		m_write_loc = base_off + size;
-		beginUse(usage_mask);
-		m_amt_allocated.fetch_add(size + prefix_size, std::memory_order_relaxed);
+		consumeAmt(size + prefix_size);
 		return reinterpret_cast<char*>(this) + base_off - prefix_size;
 	}
 
 	static Buffer* make(int quadrant_shift)
 	{
 		size_t size = 4ull << quadrant_shift;
-		Buffer* buffer = reinterpret_cast<Buffer*>(_aligned_malloc(size, 32));
+		Buffer* buffer = reinterpret_cast<Buffer*>(_aligned_malloc(size, alignof(Buffer)));
 		buffer->m_size = size;
 		buffer->m_quadrant_shift = quadrant_shift;
+		buffer->m_usage_credit = 0;
+		buffer->m_amt_credit = 0;
 		buffer->m_amt_allocated.store(1, std::memory_order_relaxed);
 		for (std::atomic<size_t>& usage : buffer->m_usage)
 			usage.store(0, std::memory_order_relaxed);
@@ -175,21 +275,29 @@ struct GSRingHeap::Buffer
 };
 
 const size_t GSRingHeap::Buffer::BEGINNING_OFFSET = alignTo<64>(sizeof(Buffer));
+thread_local GSRingHeap::Buffer::PendingFrees GSRingHeap::Buffer::s_pending_frees;
 constexpr size_t GSRingHeap::MIN_ALIGN;
 
 GSRingHeap::GSRingHeap()
 {
 	m_current_buffer = Buffer::make(14); // Start with 64k buffer
+	m_stats.buffer_size = m_current_buffer->m_size;
 }
 
 GSRingHeap::~GSRingHeap() noexcept
 {
+	flushFrees();
 	orphanBuffer();
 }
 
+void GSRingHeap::flushFrees() noexcept
+{
+	Buffer::flushPendingFrees();
+}
+
 void GSRingHeap::orphanBuffer() noexcept
 {
-	m_current_buffer->decref(1);
+	m_current_buffer->orphan();
 }
 
 void* GSRingHeap::alloc_internal(size_t size, size_t align_mask, size_t prefix_size)
@@ -197,6 +305,9 @@ void* GSRingHeap::alloc_internal(size_t size, size_t align_mask, size_t prefix_s
 	prefix_size += sizeof(Buffer*); // Add space for a pointer to the buffer
 	size_t total_size = size + prefix_size;
 
+	m_stats.allocations++;
+	m_stats.bytes_allocated += total_size;
+
 	if (likely(total_size <= (m_current_buffer->m_size / 2)))
 	{
 		if (void* ptr = m_current_buffer->alloc(size, align_mask, prefix_size))
@@ -219,6 +330,8 @@ void* GSRingHeap::alloc_internal(size_t size, size_t align_mask, size_t prefix_s
 		shift--;
 	Buffer* new_buffer = Buffer::make(shift);
 	orphanBuffer();
+	m_stats.buffer_grows++;
+	m_stats.buffer_size = new_buffer->m_size;
 	m_current_buffer = new_buffer;
 	void* ptr = m_current_buffer->alloc(size, align_mask, prefix_size);
 
@@ -27,10 +27,27 @@
 /// - Other threads read from allocations (once shared, no one writes)
 /// - Any thread can free
 /// - Frees are done in approximately the same order as allocations (but not exactly the same order)
+/// - A thread that frees calls `flushFrees()` before it goes idle (frees are batched per thread)
 class GSRingHeap
 {
+public:
+	/// Counters for the producer thread's allocations
+	struct Stats
+	{
+		/// Number of allocations made
+		uint64_t allocations = 0;
+		/// Bytes handed out, including allocation headers
+		uint64_t bytes_allocated = 0;
+		/// Number of times the ring caught up with live allocations and had to move to a larger buffer
+		uint32_t buffer_grows = 0;
+		/// Size of the buffer currently being allocated from
+		size_t buffer_size = 0;
+	};
+
+private:
 	struct Buffer;
 	Buffer* m_current_buffer;
+	Stats m_stats;
 
 	void orphanBuffer() noexcept;
 	/// Allocate a value of `size` bytes with `prefix_size` bytes before it (for allocation tracking) and alignment specified by `align_mask`
@@ -50,6 +67,12 @@ public:
 	GSRingHeap();
 	~GSRingHeap() noexcept;
 
+	/// Allocation counters, only valid to read from the allocating thread
+	const Stats& getStats() const { return m_stats; }
+
+	/// Hand back the frees this thread has batched up, so their memory can be reused
+	static void flushFrees() noexcept;
+
 	/// Allocate a piece of memory with the given size and alignment
 	void* alloc(size_t size, size_t align)
 	{
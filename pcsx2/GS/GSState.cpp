@@ -224,7 +224,11 @@ void GSState::SetPrimHandlers()
 	m_fpGIFRegHandlerXYZ[P][2] = &GSState::GIFRegHandlerXYZ2<P, 0, auto_flush, index_swap>; \
 	m_fpGIFRegHandlerXYZ[P][3] = &GSState::GIFRegHandlerXYZ2<P, 1, auto_flush, index_swap>; \
 	m_fpGIFPackedRegHandlerSTQRGBAXYZF2[P] = &GSState::GIFPackedRegHandlerSTQRGBAXYZF2<P, auto_flush, index_swap>; \
-	m_fpGIFPackedRegHandlerSTQRGBAXYZ2[P] = &GSState::GIFPackedRegHandlerSTQRGBAXYZ2<P, auto_flush, index_swap>;
+	m_fpGIFPackedRegHandlerSTQRGBAXYZ2[P] = &GSState::GIFPackedRegHandlerSTQRGBAXYZ2<P, auto_flush, index_swap>; \
+	m_fpGIFPackedRegHandlerRGBAXYZ[P][0] = &GSState::GIFPackedRegHandlerRGBAXYZ<P, auto_flush, index_swap, true, true>; \
+	m_fpGIFPackedRegHandlerRGBAXYZ[P][1] = &GSState::GIFPackedRegHandlerRGBAXYZ<P, auto_flush, index_swap, true, false>; \
+	m_fpGIFPackedRegHandlerRGBAXYZ[P][2] = &GSState::GIFPackedRegHandlerRGBAXYZ<P, auto_flush, index_swap, false, true>; \
+	m_fpGIFPackedRegHandlerRGBAXYZ[P][3] = &GSState::GIFPackedRegHandlerRGBAXYZ<P, auto_flush, index_swap, false, false>;
 
 	SetHandlerXYZ(GS_POINTLIST, true, false);
 	SetHandlerXYZ(GS_LINELIST, auto_flush, index_swap);
@@ -592,6 +596,70 @@ void GSState::GIFPackedRegHandlerSTQRGBAXYZ2(const GIFPackedReg* RESTRICT r, u32
 	m_q = r[-3].STQ.Q; // remember the last one, STQ outputs this to the temp Q each time
 }
 
+// [UV], RGBA, XYZF2/XYZ2 - same as running the individual packed handlers, see STQRGBAXYZF2 above.
+template <u32 prim, bool auto_flush, bool index_swap, bool uv, bool xyzf>
+void GSState::GIFPackedRegHandlerRGBAXYZ(const GIFPackedReg* RESTRICT r, u32 size)
+{
+	constexpr u32 nreg = uv ? 3 : 2;
+
+	bool flushes_checked = false;
+
+	if (GSUtil::GetPrimClass(m_prev_env.PRIM.PRIM) != GSUtil::GetPrimClass(m_env.PRIM.PRIM) || (m_dirty_gs_regs & (1 << DIRTY_REG_XYOFFSET)))
+	{
+		flushes_checked = true;
+		CheckFlushes();
+	}
+
+	if (uv && GSConfig.UserHacks_ForceEvenSpritePosition)
+		m_isPackedUV_HackFlag = true; // see GIFPackedRegHandlerUV_Hack
+
+	const GSVector4i mask = GSVector4i::load(0x0c080400);
+	const GIFPackedReg* RESTRICT r_end = r + size;
+
+	while (r < r_end)
+	{
+		if (uv)
+		{
+			const GSVector4i v = GSVector4i::loadl(&r[0]) & GSVector4i::x00003fff();
+
+			m_v.UV = (u32)GSVector4i::store(v.ps32(v));
+		}
+
+		const GIFPackedReg* RESTRICT rgba = &r[nreg - 2];
+		const GIFPackedReg* RESTRICT xyz = &r[nreg - 1];
+
+		m_v.RGBAQ.U32[0] = (u32)GSVector4i::store(GSVector4i::load<false>(rgba).shuffle8(mask));
+		m_v.RGBAQ.Q = m_q;
+
+		if (xyzf)
+		{
+			GSVector4i xy = GSVector4i::loadl(&xyz->U64[0]);
+			GSVector4i zf = GSVector4i::loadl(&xyz->U64[1]);
+			xy = xy.upl16(xy.srl<4>()).upl32(GSVector4i::load((int)m_v.UV));
+			zf = zf.srl32<4>() & GSVector4i::x00ffffff().upl32(GSVector4i::x000000ff());
+
+			m_v.m[1] = xy.upl32(zf);
+		}
+		else
+		{
+			const GSVector4i xy = GSVector4i::loadl(&xyz->U64[0]);
+			const GSVector4i z = GSVector4i::loadl(&xyz->U64[1]);
+
+			m_v.m[1] = xy.upl16(xy.srl<4>()).upl32(z).upl64(GSVector4i::loadl(&m_v.UV));
+		}
+
+		const bool skip = xyz->XYZF2.Skip();
+		if (!flushes_checked && !skip)
+		{
+			flushes_checked = true;
+			CheckFlushes();
+		}
+		VertexKick<prim, auto_flush, index_swap>(skip);
+
+		r += nreg;
+	}
+}
+
 void GSState::GIFPackedRegHandlerNOP(const GIFPackedReg* RESTRICT r, u32 size)
 {
 }
@@ -1396,7 +1464,11 @@ inline bool GSState::TestDrawChanged()
 			return false;
 	}
 
-	if ((m_dirty_gs_regs & ((1 << DIRTY_REG_TEST) | (1 << DIRTY_REG_SCISSOR) | (1 << DIRTY_REG_XYOFFSET) | (1 << DIRTY_REG_SCANMSK) | (1 << DIRTY_REG_DTHE))) || ((m_dirty_gs_regs & (1 << DIRTY_REG_DIMX)) && m_prev_env.DTHE.DTHE))
+	if ((m_dirty_gs_regs & ((1 << DIRTY_REG_TEST) | (1 << DIRTY_REG_XYOFFSET) | (1 << DIRTY_REG_SCANMSK) | (1 << DIRTY_REG_DTHE))) || ((m_dirty_gs_regs & (1 << DIRTY_REG_DIMX)) && m_prev_env.DTHE.DTHE))
+		return true;
+
+	const bool scissor_changed = (m_dirty_gs_regs & (1 << DIRTY_REG_SCISSOR)) != 0;
+	if (scissor_changed && !TestScissorChangeUnused())
 		return true;
 
 	if (m_prev_env.PRIM.ABE && (m_dirty_gs_regs & ((1 << DIRTY_REG_ALPHA) | (1 << DIRTY_REG_PABE))))
@@ -1429,11 +1501,35 @@ inline bool GSState::TestDrawChanged()
 			return true;
 	}
 
+	// Nothing queued touches the changed scissor edges, so carry on with the new scissor and merge
+	// the following prims into this draw. Lots of UI is drawn one scissored sprite at a time.
+	if (scissor_changed)
+	{
+		m_prev_env.CTXT[context].SCISSOR = m_env.CTXT[context].SCISSOR;
+		m_prev_env.CTXT[context].scissor = m_env.CTXT[context].scissor;
+	}
+
 	m_dirty_gs_regs = 0;
 
 	return false;
 }
 
+// Checks if the queued prims would be drawn the same with both the old and new scissor.
+bool GSState::TestScissorChangeUnused() const
+{
+	const int context = m_prev_env.PRIM.CTXT;
+	const GSVector4i old_cull = m_prev_env.CTXT[context].scissor.cull;
+	const GSVector4i new_cull = m_env.CTXT[context].scissor.cull;
+
+	// Edges which moved must be at least a pixel clear of the prims, so half pixel offsets and
+	// upscaling can't pull anything across them. Edges which didn't move clip the same either way.
+	const GSVector4i inner = old_cull.max_i32(new_cull).blend32<0xc>(old_cull.min_i32(new_cull)) +
+		GSVector4i::cxpr(16, 16, -16, -16);
+	const GSVector4i outside = m_index.bbox.lt32(inner).blend32<0xc>(m_index.bbox.gt32(inner));
+
+	return outside.andnot(old_cull.eq32(new_cull)).allfalse();
+}
+
 u32 GSState::CalcMask(int exp, int max_exp)
 {
 	const int amount = 9 + (max_exp - exp);
@@ -2200,6 +2296,30 @@ void GSState::Transfer(const u8* mem, u32 size)
 
 								mem += total * sizeof(GIFPackedReg);
 
+								break;
+							case GIFPath::TYPE_UVRGBAXYZF2: // sprites
+								(this->*m_fpGIFPackedRegHandlersC[GIF_REG_UVRGBAXYZF2])((GIFPackedReg*)mem, total);
+
+								mem += total * sizeof(GIFPackedReg);
+
+								break;
+							case GIFPath::TYPE_UVRGBAXYZ2:
+								(this->*m_fpGIFPackedRegHandlersC[GIF_REG_UVRGBAXYZ2])((GIFPackedReg*)mem, total);
+
+								mem += total * sizeof(GIFPackedReg);
+
+								break;
+							case GIFPath::TYPE_RGBAXYZF2: // untextured
+								(this->*m_fpGIFPackedRegHandlersC[GIF_REG_RGBAXYZF2])((GIFPackedReg*)mem, total);
+
+								mem += total * sizeof(GIFPackedReg);
+
+								break;
+							case GIFPath::TYPE_RGBAXYZ2:
+								(this->*m_fpGIFPackedRegHandlersC[GIF_REG_RGBAXYZ2])((GIFPackedReg*)mem, total);
+
+								mem += total * sizeof(GIFPackedReg);
+
 								break;
 							default:
 								break;
@@ -2529,6 +2649,10 @@ void GSState::UpdateVertexKick()
 
 	m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZF2] = m_fpGIFPackedRegHandlerSTQRGBAXYZF2[prim];
 	m_fpGIFPackedRegHandlersC[GIF_REG_STQRGBAXYZ2] = m_fpGIFPackedRegHandlerSTQRGBAXYZ2[prim];
+	m_fpGIFPackedRegHandlersC[GIF_REG_UVRGBAXYZF2] = m_fpGIFPackedRegHandlerRGBAXYZ[prim][0];
+	m_fpGIFPackedRegHandlersC[GIF_REG_UVRGBAXYZ2] = m_fpGIFPackedRegHandlerRGBAXYZ[prim][1];
+	m_fpGIFPackedRegHandlersC[GIF_REG_RGBAXYZF2] = m_fpGIFPackedRegHandlerRGBAXYZ[prim][2];
+	m_fpGIFPackedRegHandlersC[GIF_REG_RGBAXYZ2] = m_fpGIFPackedRegHandlerRGBAXYZ[prim][3];
 }
 
 void GSState::GrowVertexBuffer()
@@ -3331,6 +3455,9 @@ __forceinline void GSState::VertexKick(u32 skip)
 	if (tail >= m_vertex.maxcount)
 		GrowVertexBuffer();
 
+	const GSVector4i prim_bbox = pmin.upl64(pmax);
+	m_index.bbox = (m_index.tail > 0) ? m_index.bbox.runion(prim_bbox) : prim_bbox;
+
 	if (m_index.tail == 0 && ((m_backed_up_ctx != m_env.PRIM.CTXT) || m_dirty_gs_regs))
 	{
 		const int ctx = m_env.PRIM.CTXT;
@@ -690,6 +690,11 @@ public:
 		return GSVector4i(_mm_srai_epi16(m, i));
 	}
 
+	__forceinline GSVector4i sra16(int i) const
+	{
+		return GSVector4i(_mm_srai_epi16(m, i));
+	}
+
 	template <int i>
 	__forceinline GSVector4i sra32() const
 	{
@@ -423,6 +423,10 @@ public:
 		return GSVector8(_mm256_max_ps(m, a));
 	}
 
+	// Same names as GSVector4, so code can be written for either width
+	__forceinline GSVector8 _min(const GSVector8& a) const { return min(a); }
+	__forceinline GSVector8 _max(const GSVector8& a) const { return max(a); }
+
 	template <int mask>
 	__forceinline GSVector8 blend32(const GSVector8& a) const
 	{
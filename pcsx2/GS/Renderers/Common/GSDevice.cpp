@@ -21,6 +21,7 @@
 
 #include "GSDevice.h"
 #include "GS/GS.h"
+#include "GS/GSLocalMemory.h"
 #include "Host.h"
 
 int SetDATMShader(SetDATM datm)
@@ -341,6 +342,111 @@ void GSDevice::SortMultiStretchRects(MultiStretchRect* rects, u32 num_rects)
 	});
 }
 
+static constexpr const GSSwizzleInfo* s_local_memory_swizzles[] = {
+	&GSLocalMemory::swizzle32,
+	&GSLocalMemory::swizzle16,
+	&GSLocalMemory::swizzle16S,
+	&GSLocalMemory::swizzle8,
+	&GSLocalMemory::swizzle4,
+};
+
+void GSDevice::GenerateLocalMemorySwizzleTables(void* buffer)
+{
+	// Each table maps a position within a page to a texel offset from the start of the page.
+	u32* table = static_cast<u32*>(buffer);
+	for (const GSSwizzleInfo* swz : s_local_memory_swizzles)
+	{
+		const u32 page_width = 1u << swz->pageShiftX();
+		const u32 page_height = 1u << swz->pageShiftY();
+		const u32 bw = page_width / 64;
+		for (u32 y = 0; y < page_height; y++)
+		{
+			for (u32 x = 0; x < page_width; x++)
+				*(table++) = swz->pa(x, y, 0, bw);
+		}
+	}
+}
+
+bool GSDevice::SetupLocalMemoryDecode(LocalMemoryDecodeConstantBuffer& cb, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA,
+	const GSVector4i& rect, const GSVector4i& dst_offset)
+{
+	// Modes and tables must match decode.glsl.
+	u32 mode, table;
+	switch (TEX0.PSM)
+	{
+		case PSMCT32:
+		case PSMZ32:
+			mode = 0;
+			table = 0;
+			break;
+		case PSMCT24:
+		case PSMZ24:
+			mode = 1;
+			table = 0;
+			break;
+		case PSMCT16:
+		case PSMZ16:
+			mode = 2;
+			table = 1;
+			break;
+		case PSMCT16S:
+		case PSMZ16S:
+			mode = 2;
+			table = 2;
+			break;
+		case PSMT8:
+			mode = 3;
+			table = 3;
+			break;
+		case PSMT4:
+			mode = 4;
+			table = 4;
+			break;
+		case PSMT8H:
+			mode = 5;
+			table = 0;
+			break;
+		case PSMT4HL:
+			mode = 6;
+			table = 0;
+			break;
+		case PSMT4HH:
+			mode = 7;
+			table = 0;
+			break;
+		default:
+			return false;
+	}
+
+	const GSLocalMemory::psm_t& psm = GSLocalMemory::m_psm[TEX0.PSM];
+	const GSSwizzleInfo* swz = s_local_memory_swizzles[table];
+	u32 table_offset = LOCAL_MEMORY_SWIZZLE_OFFSET;
+	for (u32 i = 0; i < table; i++)
+		table_offset += 1u << (s_local_memory_swizzles[i]->pageShiftX() + s_local_memory_swizzles[i]->pageShiftY());
+
+	cb.SrcRect = GSVector4i(rect.x, rect.y, rect.width(), rect.height());
+	cb.DstOffset = dst_offset;
+	cb.BP = TEX0.TBP0;
+	cb.BWPages = TEX0.TBW >> (swz->pageShiftX() - 6);
+	cb.Mode = mode;
+	cb.TableOffset = table_offset;
+	cb.PageShift = swz->pageShiftX() | (swz->pageShiftY() << 8);
+	cb.AddressXor = psm.info.pa(0, 0, 0, 1u << (swz->pageShiftX() - 6));
+	cb.TEXA = TEXA.TA0 | (TEXA.TA1 << 8) | (TEXA.AEM << 16);
+	cb.AddressMask = (GSLocalMemory::m_vmsize * 8 / psm.bpp) - 1;
+	return true;
+}
+
+bool GSDevice::UpdateLocalMemoryPages(const u8* vm, const u32* pages, u32 num_pages)
+{
+	return false;
+}
+
+bool GSDevice::DecodeLocalMemory(GSTexture* dTex, int level, const LocalMemoryDecodeConstantBuffer& cb, const u32* clut)
+{
+	return false;
+}
+
 void GSDevice::ClearCurrent()
 {
 	m_current = nullptr;
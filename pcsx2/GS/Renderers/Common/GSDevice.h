@@ -177,6 +177,23 @@ struct alignas(16) InterlaceConstantBuffer
 	GSVector4 ZrH; // data passed to the shader
 };
 
+struct alignas(16) LocalMemoryDecodeConstantBuffer
+{
+	GSVector4i SrcRect; // x, y, width, height in the source texture
+	GSVector4i DstOffset; // x, y in the destination texture
+	u32 BP; // base pointer, in blocks
+	u32 BWPages; // buffer width, in pages
+	u32 Mode; // how texels are read and expanded, see decode.glsl
+	u32 TableOffset; // offset of the swizzle table for this format in the local memory buffer, in words
+	u32 PageShift; // log2 of page width | log2 of page height << 8
+	u32 AddressXor; // xor applied to texel addresses (Z formats)
+	u32 TEXA; // TA0 | TA1 << 8 | AEM << 16
+	u32 AddressMask; // wraps texel addresses to the size of local memory
+
+	/// Number of CLUT entries read by the decode, zero for formats which aren't paletted.
+	u32 GetCLUTSize() const { return (Mode < 3) ? 0 : ((Mode == 3 || Mode == 5) ? 256 : 16); }
+};
+
 enum HWBlendFlags
 {
 	// Flags to determine blending behavior
@@ -699,6 +716,7 @@ public:
 		bool clip_control         : 1; ///< Can use 0..1 depth range instead of -1..1.
 		bool stencil_buffer       : 1; ///< Supports stencil buffer, and can use for DATE.
 		bool test_and_sample_depth: 1; ///< Supports concurrently binding the depth-stencil buffer for sampling and depth testing.
+		bool local_memory_decode  : 1; ///< Can decode textures from a mirror of GS local memory with compute shaders.
 		FeatureSupport()
 		{
 			memset(this, 0, sizeof(*this));
@@ -749,6 +767,13 @@ protected:
 	static constexpr u32 MAX_TEXTURE_AGE = 10;
 	static constexpr u32 EXPAND_BUFFER_SIZE = sizeof(u16) * 16383 * 6;
 
+	// Layout of the buffer which mirrors local memory for DecodeLocalMemory(), in words: local memory itself,
+	// followed by the CLUT, followed by in-page swizzle tables for 32, 16, 16S, 8 and 4 bit formats.
+	static constexpr u32 LOCAL_MEMORY_CLUT_OFFSET = VM_SIZE / sizeof(u32);
+	static constexpr u32 LOCAL_MEMORY_SWIZZLE_OFFSET = LOCAL_MEMORY_CLUT_OFFSET + 256;
+	static constexpr u32 LOCAL_MEMORY_SWIZZLE_SIZE = (64 * 32) + (64 * 64) * 2 + (128 * 64) + (128 * 128);
+	static constexpr u32 LOCAL_MEMORY_BUFFER_SIZE = (LOCAL_MEMORY_SWIZZLE_OFFSET + LOCAL_MEMORY_SWIZZLE_SIZE) * sizeof(u32);
+
 	WindowInfo m_window_info;
 
 	GSTexture* m_merge = nullptr;
@@ -785,6 +810,14 @@ public:
 	/// Generates a fixed index buffer for expanding points and sprites. Buffer is assumed to be at least EXPAND_BUFFER_SIZE in size.
 	static void GenerateExpansionIndexBuffer(void* buffer);
 
+	/// Generates the swizzle tables used by DecodeLocalMemory(). Buffer is assumed to be at least LOCAL_MEMORY_SWIZZLE_SIZE words.
+	static void GenerateLocalMemorySwizzleTables(void* buffer);
+
+	/// Fills in the constants for decoding a rectangle of a texture from local memory. Returns false if the format
+	/// can't be decoded on the GPU.
+	static bool SetupLocalMemoryDecode(LocalMemoryDecodeConstantBuffer& cb, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA,
+		const GSVector4i& rect, const GSVector4i& dst_offset);
+
 	/// Returns the maximum number of mipmap levels for a given texture size.
 	static int GetMipmapLevelsForSize(int width, int height);
 
@@ -848,6 +881,13 @@ public:
 	/// Uses box downsampling to resize a texture.
 	virtual void FilteredDownsampleTexture(GSTexture* sTex, GSTexture* dTex, u32 downsample_factor, const GSVector2i& clamp_min, const GSVector4& dRect) = 0;
 
+	/// Copies pages of local memory to the device's mirror of it. Returns false if the pages couldn't be uploaded.
+	virtual bool UpdateLocalMemoryPages(const u8* vm, const u32* pages, u32 num_pages);
+
+	/// Decodes a rectangle of a texture from the local memory mirror with a compute shader. The CLUT is 256 colours.
+	/// Returns false if the caller needs to fall back to decoding on the CPU.
+	virtual bool DecodeLocalMemory(GSTexture* dTex, int level, const LocalMemoryDecodeConstantBuffer& cb, const u32* clut);
+
 	virtual void RenderHW(GSHWDrawConfig& config) = 0;
 
 	virtual void ClearSamplerCache() = 0;
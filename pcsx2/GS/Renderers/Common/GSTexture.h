@@ -150,6 +150,7 @@ public:
 
 	void GenerateMipmapsIfNeeded();
 	void ClearMipmapGenerationFlag() { m_needs_mipmaps_generated = false; }
+	void SetMipmapGenerationFlag(int layer) { m_needs_mipmaps_generated |= (layer == 0); }
 
 	// Typical size of a RGBA texture
 	u32 GetMemUsage() const { return m_size.x * m_size.y * (m_format == Format::UNorm8 ? 1 : 4); }
@@ -106,13 +106,15 @@ void GSVertexTraceFMM::FindMinMax(GSVertexTrace& vt, const void* vertex, const u
 
 	const GSVertex* RESTRICT v = (GSVertex*)vertex;
 
-	// Process 2 vertices at a time for increased efficiency
-	auto processVertices = [&tmin, &tmax, &cmin, &cmax, &pmin, &pmax, n](const GSVertex& v0, const GSVertex& v1, bool finalVertex)
+	// Works on one pair of vertices per 128-bit lane, so the same code handles GSVector4 and (with two pairs) GSVector8
+	auto accumulate = [n](auto c0, auto c1, auto stq0, auto stq1, auto xyzf0, auto xyzf1, bool finalVertex,
+		auto& tmin, auto& tmax, auto& cmin, auto& cmax, auto& pmin, auto& pmax)
 	{
+		using VectorI = decltype(xyzf0);
+		using VectorF = decltype(stq0);
+
 		if (color)
 		{
-			GSVector4i c0 = GSVector4i::load(v0.RGBAQ.U32[0]);
-			GSVector4i c1 = GSVector4i::load(v1.RGBAQ.U32[0]);
 			if (iip || finalVertex)
 			{
 				cmin = cmin.min_u8(c0.min_u8(c1));
@@ -122,7 +124,7 @@ void GSVertexTraceFMM::FindMinMax(GSVertexTrace& vt, const void* vertex, const u
 			{
 				// For even n, we process v1 and v2 of the same prim
 				// (For odd n, we process one vertex from each of two prims)
-				GSVector4i c = flat_swapped ? c0 : c1;
+				VectorI c = flat_swapped ? c0 : c1;
 				cmin = cmin.min_u8(c);
 				cmax = cmax.max_u8(c);
 			}
@@ -132,10 +134,7 @@ void GSVertexTraceFMM::FindMinMax(GSVertexTrace& vt, const void* vertex, const u
 		{
 			if (!fst)
 			{
-				GSVector4 stq0 = GSVector4::cast(GSVector4i(v0.m[0]));
-				GSVector4 stq1 = GSVector4::cast(GSVector4i(v1.m[0]));
-
-				GSVector4 q;
+				VectorF q;
 				// Sprites always have indices == vertices, so we don't have to look at the index table here
 				if (primclass == GS_SPRITE_CLASS)
 					q = stq1.wwww();
@@ -146,7 +145,7 @@ void GSVertexTraceFMM::FindMinMax(GSVertexTrace& vt, const void* vertex, const u
 				//       make sure to remove the z (rgba) field as it's often denormal.
 				//       Then, use GSVector4::noopt() to prevent clang from optimizing out your "useless" shuffle
 				//       e.g. stq = (stq.xyww() / stq.wwww()).noopt().xyww(stq);
-				GSVector4 st = stq0.xyxy(stq1) / q;
+				VectorF st = stq0.xyxy(stq1) / q;
 
 				stq0 = st.xyww(primclass == GS_SPRITE_CLASS ? stq1 : stq0);
 				stq1 = st.zwww(stq1);
@@ -156,35 +155,71 @@ void GSVertexTraceFMM::FindMinMax(GSVertexTrace& vt, const void* vertex, const u
 			}
 			else
 			{
-				GSVector4i uv0(v0.m[1]);
-				GSVector4i uv1(v1.m[1]);
-
-				GSVector4 st0 = GSVector4(uv0.uph16()).xyxy();
-				GSVector4 st1 = GSVector4(uv1.uph16()).xyxy();
+				VectorF st0 = VectorF(xyzf0.uph16()).xyxy();
+				VectorF st1 = VectorF(xyzf1.uph16()).xyxy();
 
 				tmin = tmin._min(st0._min(st1));
 				tmax = tmax._max(st0._max(st1));
 			}
 		}
 
-		GSVector4i xyzf0(v0.m[1]);
-		GSVector4i xyzf1(v1.m[1]);
-
-		GSVector4i xy0 = xyzf0.upl16();
-		GSVector4i zf0 = xyzf0.ywyw();
-		GSVector4i xy1 = xyzf1.upl16();
-		GSVector4i zf1 = xyzf1.ywyw();
+		VectorI xy0 = xyzf0.upl16();
+		VectorI zf0 = xyzf0.ywyw();
+		VectorI xy1 = xyzf1.upl16();
+		VectorI zf1 = xyzf1.ywyw();
 
-		GSVector4i p0 = xy0.blend32<0xc>(primclass == GS_SPRITE_CLASS ? zf1 : zf0);
-		GSVector4i p1 = xy1.blend32<0xc>(zf1);
+		constexpr int zf_mask = sizeof(VectorI) == sizeof(GSVector4i) ? 0xc : 0xcc;
+		VectorI p0 = xy0.template blend32<zf_mask>(primclass == GS_SPRITE_CLASS ? zf1 : zf0);
+		VectorI p1 = xy1.template blend32<zf_mask>(zf1);
 
 		pmin = pmin.min_u32(p0.min_u32(p1));
 		pmax = pmax.max_u32(p0.max_u32(p1));
 	};
 
+	// Process 2 vertices at a time for increased efficiency
+	auto processVertices = [&](const GSVertex& v0, const GSVertex& v1, bool finalVertex)
+	{
+		accumulate(GSVector4i::load(v0.RGBAQ.U32[0]), GSVector4i::load(v1.RGBAQ.U32[0]),
+			GSVector4::cast(GSVector4i(v0.m[0])), GSVector4::cast(GSVector4i(v1.m[0])),
+			GSVector4i(v0.m[1]), GSVector4i(v1.m[1]), finalVertex,
+			tmin, tmax, cmin, cmax, pmin, pmax);
+	};
+
+#if _M_SSE >= 0x501
+	// Wide version, (v0, v1) go in the low lane and (v2, v3) in the high lane
+	// Kept in separate accumulators and folded into the 128-bit ones at the end
+	GSVector8 tmin8 = GSVector8::cxpr(FLT_MAX);
+	GSVector8 tmax8 = GSVector8::cxpr(-FLT_MAX);
+	GSVector8i cmin8 = GSVector8i::xffffffff();
+	GSVector8i cmax8 = GSVector8i::zero();
+	GSVector8i pmin8 = GSVector8i::xffffffff();
+	GSVector8i pmax8 = GSVector8i::zero();
+
+	auto processVertices4 = [&](const GSVertex& v0, const GSVertex& v1, const GSVertex& v2, const GSVertex& v3, bool finalVertex)
+	{
+		auto pair = [](const GSVector4i& lo, const GSVector4i& hi) { return GSVector8i::cast(lo).insert<1>(hi); };
+
+		accumulate(
+			pair(GSVector4i::load(v0.RGBAQ.U32[0]), GSVector4i::load(v2.RGBAQ.U32[0])),
+			pair(GSVector4i::load(v1.RGBAQ.U32[0]), GSVector4i::load(v3.RGBAQ.U32[0])),
+			GSVector8::cast(pair(GSVector4i(v0.m[0]), GSVector4i(v2.m[0]))),
+			GSVector8::cast(pair(GSVector4i(v1.m[0]), GSVector4i(v3.m[0]))),
+			pair(GSVector4i(v0.m[1]), GSVector4i(v2.m[1])),
+			pair(GSVector4i(v1.m[1]), GSVector4i(v3.m[1])), finalVertex,
+			tmin8, tmax8, cmin8, cmax8, pmin8, pmax8);
+	};
+#endif
+
 	if (n == 2)
 	{
-		for (int i = 0; i < count; i += 2)
+		int i = 0;
+#if _M_SSE >= 0x501
+		for (; i < (count - 3); i += 4)
+		{
+			processVertices4(v[index[i + 0]], v[index[i + 1]], v[index[i + 2]], v[index[i + 3]], false);
+		}
+#endif
+		for (; i < count; i += 2)
 		{
 			processVertices(v[index[i + 0]], v[index[i + 1]], false);
 		}
@@ -192,6 +227,12 @@ void GSVertexTraceFMM::FindMinMax(GSVertexTrace& vt, const void* vertex, const u
 	else if (iip || n == 1) // iip means final and non-final vertexes are treated the same
 	{
 		int i = 0;
+#if _M_SSE >= 0x501
+		for (; i < (count - 3); i += 4) // 4x loop unroll
+		{
+			processVertices4(v[index[i + 0]], v[index[i + 1]], v[index[i + 2]], v[index[i + 3]], true);
+		}
+#endif
 		for (; i < (count - 1); i += 2) // 2x loop unroll
 		{
 			processVertices(v[index[i + 0]], v[index[i + 1]], true);
@@ -231,6 +272,15 @@ void GSVertexTraceFMM::FindMinMax(GSVertexTrace& vt, const void* vertex, const u
 		}
 	}
 
+#if _M_SSE >= 0x501
+	tmin = tmin._min(tmin8.extract<0>()._min(tmin8.extract<1>()));
+	tmax = tmax._max(tmax8.extract<0>()._max(tmax8.extract<1>()));
+	cmin = cmin.min_u8(cmin8.extract<0>().min_u8(cmin8.extract<1>()));
+	cmax = cmax.max_u8(cmax8.extract<0>().max_u8(cmax8.extract<1>()));
+	pmin = pmin.min_u32(pmin8.extract<0>().min_u32(pmin8.extract<1>()));
+	pmax = pmax.max_u32(pmax8.extract<0>().max_u32(pmax8.extract<1>()));
+#endif
+
 	GSVector4 o(context->XYOFFSET);
 	GSVector4 s(1.0f / 16, 1.0f / 16, 2.0f, 1.0f);
 
@@ -1334,6 +1334,7 @@ bool GSHwHack::MV_Growlanser(GSRendererHW& r)
 
 	const GSVector4i rc = src->GetUnscaledRect().rintersect(dst->GetUnscaledRect());
 	dst->m_TEX0.TBW = src->m_TEX0.TBW;
+	g_texture_cache->InvalidateTargetPages();
 	dst->UpdateValidity(rc);
 
 	g_gs_device->StretchRect(src->GetTexture(), GSVector4(rc) / GSVector4(src->GetUnscaledSize()).xyxy(),
@@ -2719,6 +2719,8 @@ void GSRendererHW::Draw()
 
 		if (ds && (!is_possible_mem_clear || ds->m_TEX0.PSM != ZBUF_TEX0.PSM || (rt && ds->m_TEX0.TBW != rt->m_TEX0.TBW)))
 			ds->m_TEX0 = ZBUF_TEX0;
+
+		g_texture_cache->InvalidateTargetPages();
 	}
 	else if (!m_texture_shuffle)
 	{
@@ -2735,6 +2737,10 @@ void GSRendererHW::Draw()
 			ds->m_TEX0.TBW = std::max(ds->m_TEX0.TBW, ZBUF_TEX0.TBW);
 			ds->m_TEX0.PSM = ZBUF_TEX0.PSM;
 		}
+
+		// A wider buffer reaches further, the end block catches up on the next validity update.
+		if (rt || ds)
+			g_texture_cache->InvalidateTargetPages();
 	}
 
 	// Figure out which channels we're writing.
@@ -6377,6 +6383,9 @@ bool GSRendererHW::TryGSMemClear(bool no_rt, bool preserve_rt, bool invalidate_r
 
 void GSRendererHW::ClearGSLocalMemory(const GSOffset& off, const GSVector4i& r, u32 vert_color)
 {
+	// The texture cache is only invalidated when the caller asks for it, but the memory changes regardless.
+	g_texture_cache->InvalidateMirroredPages(off, r);
+
 	const u32 psm = (off.psm() == PSMCT32 && m_cached_ctx.FRAME.FBMSK == 0xFF000000u) ? PSMCT24 : off.psm();
 	const int format = GSLocalMemory::m_psm[psm].fmt;
 
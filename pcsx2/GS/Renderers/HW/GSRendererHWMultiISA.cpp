@@ -528,6 +528,12 @@ bool GSRendererHWFunctions::SwPrimRender(GSRendererHW& hw, bool invalidate_tc, b
 
 	static_cast<GSSingleRasterizer*>(hw.m_sw_rasterizer.get())->Draw(data);
 
+	// Memory is written even when the texture cache isn't invalidated, and depth never goes through it.
+	if (fwrite)
+		g_texture_cache->InvalidateMirroredPages(context->offset.fb, bbox);
+	if (zwrite)
+		g_texture_cache->InvalidateMirroredPages(context->offset.zb, bbox);
+
 	if (invalidate_tc)
 		g_texture_cache->InvalidateVideoMem(context->offset.fb, bbox);
 
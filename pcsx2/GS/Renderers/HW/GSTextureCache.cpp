@@ -75,6 +75,7 @@ void GSTextureCache::RemoveAll(bool sources, bool targets, bool hash_cache)
 			m_dst[type].clear();
 		}
 
+		m_dst_pages_dirty = true;
 		m_target_heights.clear();
 		m_surface_offset_cache.clear();
 		m_target_memory_usage = 0;
@@ -89,6 +90,8 @@ void GSTextureCache::RemoveAll(bool sources, bool targets, bool hash_cache)
 		m_hash_cache_memory_usage = 0;
 		m_hash_cache_replacement_memory_usage = 0;
 	}
+
+	m_mirrored_pages.reset();
 }
 
 bool GSTextureCache::FullRectDirty(Target* target, u32 rgba_mask)
@@ -1944,6 +1947,7 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(GIFRegTEX0 TEX0, const GSVe
 
 					dst->m_was_dst_matched = true;
 					dst->m_TEX0.TBW = dst_match->m_TEX0.TBW;
+					InvalidateTargetPages();
 					// Force the valid rect to the new size in case of shrinkage.
 					dst->m_valid = dst_match->m_valid;
 					dst->UpdateValidity(dst_match->m_valid);
@@ -2100,6 +2104,7 @@ GSTextureCache::Target* GSTextureCache::LookupTarget(GIFRegTEX0 TEX0, const GSVe
 			dst->m_32_bits_fmt = dst_match->m_32_bits_fmt;
 			dst->OffsetHack_modxy = dst_match->OffsetHack_modxy;
 			dst->m_end_block = dst_match->m_end_block; // If we're copying the size, we need to keep the end block.
+			m_dst_pages_dirty = true;
 			dst->m_valid = dst_match->m_valid;
 			dst->m_valid_alpha_low = dst_match->m_valid_alpha_low; //&& psm_s.trbpp != 24;
 			dst->m_valid_alpha_high = dst_match->m_valid_alpha_high; //&& psm_s.trbpp != 24;
@@ -2831,6 +2836,9 @@ void GSTextureCache::InvalidateContainedTargets(u32 start_bp, u32 end_bp, u32 wr
 	const bool preserve_alpha = (GSLocalMemory::m_psm[write_psm].trbpp == 24);
 	for (int type = 0; type < 2; type++)
 	{
+		if (!TargetPagesOverlap(type, start_bp, end_bp))
+			continue;
+
 		auto& list = m_dst[type];
 		for (auto i = list.begin(); i != list.end();)
 		{
@@ -2972,6 +2980,8 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 
 	off.loopPages(rect, [this, &rect, bp, bw, psm, &found](u32 page)
 	{
+		m_mirrored_pages.reset(page);
+
 		auto& list = m_src.m_map[page];
 		for (auto i = list.begin(); i != list.end();)
 		{
@@ -3047,6 +3057,9 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 
 	for (int type = 0; type < 2; type++)
 	{
+		if (!TargetPagesOverlap(type, bp, end_bp))
+			continue;
+
 		auto& list = m_dst[type];
 		for (auto i = list.begin(); i != list.end();)
 		{
@@ -3108,6 +3121,42 @@ void GSTextureCache::InvalidateVideoMem(const GSOffset& off, const GSVector4i& r
 	}
 }
 
+void GSTextureCache::InvalidateMirroredPages(const GSOffset& off, const GSVector4i& r)
+{
+	if (m_mirrored_pages.none())
+		return;
+
+	off.loopPages(r, [this](u32 page) { m_mirrored_pages.reset(page); });
+}
+
+bool GSTextureCache::DecodeSourceOnGPU(GSTexture* tex, int level, const GSOffset& off, const GIFRegTEX0& TEX0,
+	const GIFRegTEXA& TEXA, const GSVector4i& rect, const GSVector4i& dst_offset)
+{
+	LocalMemoryDecodeConstantBuffer cb;
+	if (!GSDevice::SetupLocalMemoryDecode(cb, TEX0, TEXA, rect, dst_offset))
+		return false;
+
+	u32 pages[MAX_PAGES];
+	u32 num_pages = 0;
+	off.loopPages(rect, [this, &pages, &num_pages](u32 page) {
+		if (!m_mirrored_pages.test(page))
+		{
+			m_mirrored_pages.set(page);
+			pages[num_pages++] = page;
+		}
+	});
+
+	if (num_pages > 0 && !g_gs_device->UpdateLocalMemoryPages(g_gs_renderer->m_mem.vm8(), pages, num_pages))
+	{
+		for (u32 i = 0; i < num_pages; i++)
+			m_mirrored_pages.reset(pages[i]);
+
+		return false;
+	}
+
+	return g_gs_device->DecodeLocalMemory(tex, level, cb, g_gs_renderer->m_mem.m_clut);
+}
+
 // Goal: retrieve the data from the GPU to the GS memory.
 // Called each time you want to read from the GS memory.
 // full_flush is set when it's a Local->Local stransfer and both src and destination are the same.
@@ -3866,6 +3915,9 @@ GSTextureCache::Target* GSTextureCache::FindOverlappingTarget(u32 BP, u32 end_bp
 {
 	for (int i = 0; i < 2; i++)
 	{
+		if (!TargetPagesOverlap(i, BP, end_bp))
+			continue;
+
 		for (Target* tgt : m_dst[i])
 		{
 			if (CheckOverlap(tgt->m_TEX0.TBP0, tgt->m_end_block, BP, end_bp))
@@ -3882,6 +3934,39 @@ GSTextureCache::Target* GSTextureCache::FindOverlappingTarget(u32 BP, u32 BW, u3
 	return FindOverlappingTarget(BP, end_bp);
 }
 
+bool GSTextureCache::TargetPagesOverlap(int type, u32 bp, u32 end_bp) const
+{
+	if (m_dst_pages_dirty)
+	{
+		for (int i = 0; i < 2; i++)
+		{
+			m_dst_pages[i].reset();
+			for (const Target* t : m_dst[i])
+			{
+				const u32 start_page = t->m_TEX0.TBP0 / BLOCKS_PER_PAGE;
+				const u32 end_page = std::min(t->UnwrappedEndBlock() / BLOCKS_PER_PAGE, start_page + MAX_PAGES - 1);
+				for (u32 page = start_page; page <= end_page; page++)
+					m_dst_pages[i].set(page % MAX_PAGES);
+			}
+		}
+
+		m_dst_pages_dirty = false;
+	}
+
+	// Odd ranges aren't worth reasoning about, just let the caller check the list.
+	if (end_bp < bp || (end_bp - bp) >= MAX_BLOCKS)
+		return true;
+
+	const u32 end_page = end_bp / BLOCKS_PER_PAGE;
+	for (u32 page = bp / BLOCKS_PER_PAGE; page <= end_page; page++)
+	{
+		if (m_dst_pages[type].test(page % MAX_PAGES))
+			return true;
+	}
+
+	return false;
+}
+
 GSVector2i GSTextureCache::GetTargetSize(u32 bp, u32 fbw, u32 psm, s32 min_width, s32 min_height)
 {
 	TargetHeightElem search = {};
@@ -4987,6 +5072,7 @@ GSTextureCache::Target* GSTextureCache::Target::Create(GIFRegTEX0 TEX0, int w, i
 	g_texture_cache->m_target_memory_usage += t->m_texture->GetMemUsage();
 
 	g_texture_cache->m_dst[type].push_front(t);
+	g_texture_cache->m_dst_pages_dirty = true;
 
 	return t;
 }
@@ -5190,6 +5276,7 @@ void GSTextureCache::Read(Target* t, const GSVector4i& r)
 	}
 
 	dltex->get()->Unmap();
+	InvalidateMirroredPages(off, r);
 }
 
 void GSTextureCache::Read(Source* t, const GSVector4i& r)
@@ -5211,6 +5298,7 @@ void GSTextureCache::Read(Source* t, const GSVector4i& r)
 		g_gs_renderer->m_mem.WritePixel32(
 			const_cast<u8*>(m_color_download_texture->GetMapPointer()), m_color_download_texture->GetMapPitch(), off, r);
 		m_color_download_texture->Unmap();
+		InvalidateMirroredPages(off, r);
 	}
 }
 
@@ -5483,10 +5571,24 @@ void GSTextureCache::Source::Flush(u32 count, int layer, const GSOffset& off)
 
 	pitch = VectorAlign(pitch);
 
+	// Decoding on the GPU skips both the unswizzle and the upload. GPU palette sources want indices rather than
+	// colours, so they're always read on the CPU.
+	const bool gpu_decode = !m_palette && g_gs_device->Features().local_memory_decode;
+
 	for (u32 i = 0; i < count; i++)
 	{
 		const GSVector4i r(m_write.rect[i]);
 
+		if (gpu_decode)
+		{
+			const GSVector4i rint(r.rintersect(tex_r));
+			if (rint.rempty() ||
+				g_texture_cache->DecodeSourceOnGPU(m_texture, layer, off, m_TEX0, m_TEXA, rint, rint - tex_r.xyxy()))
+			{
+				continue;
+			}
+		}
+
 		// if update rect lies to the left/above of the region rectangle, or extends past the texture bounds, we can't use a direct map
 		if (((r > tex_r).mask() & 0xff00) == 0 && ((tex_r > r).mask() & 0x00ff) == 0)
 		{
@@ -5858,14 +5960,22 @@ void GSTextureCache::Target::ResizeValidity(const GSVector4i& rect)
 {
 	if (!m_valid.eq(GSVector4i::zero()))
 	{
+		const u32 old_end_block = m_end_block;
+
 		m_valid = m_valid.rintersect(rect);
 		m_drawn_since_read = m_drawn_since_read.rintersect(rect);
 		m_end_block = GSLocalMemory::GetEndBlockAddress(m_TEX0.TBP0, m_TEX0.TBW, m_TEX0.PSM, m_valid);
+
+		// The rect can shrink while the width grew underneath it, so the end block can still move out.
+		if (m_end_block != old_end_block)
+			g_texture_cache->InvalidateTargetPages();
 	}
 }
 
 void GSTextureCache::Target::UpdateValidity(const GSVector4i& rect, bool can_resize)
 {
+	const u32 old_end_block = m_end_block;
+
 	if (m_valid.eq(GSVector4i::zero()))
 	{
 		m_valid = rect;
@@ -5878,6 +5988,9 @@ void GSTextureCache::Target::UpdateValidity(const GSVector4i& rect, bool can_res
 
 		m_end_block = GSLocalMemory::GetEndBlockAddress(m_TEX0.TBP0, m_TEX0.TBW, m_TEX0.PSM, m_valid);
 	}
+
+	if (m_end_block != old_end_block)
+		g_texture_cache->InvalidateTargetPages();
 }
 
 bool GSTextureCache::Target::ResizeTexture(int new_unscaled_width, int new_unscaled_height, bool recycle_old)
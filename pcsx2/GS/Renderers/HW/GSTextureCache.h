@@ -19,6 +19,7 @@
 #include "GS/Renderers/Common/GSRenderer.h"
 #include "GS/Renderers/Common/GSFastList.h"
 #include "GS/Renderers/Common/GSDirtyRect.h"
+#include <bitset>
 #include <unordered_set>
 #include <utility> /* std::pair */
 #include <limits>
@@ -424,8 +425,17 @@ protected:
 
 	FastList<Target*> m_dst[2];
 	FastList<TargetHeightElem> m_target_heights;
+
+	// Pages covered by each list's targets, from TBP0 to the end block. Only rebuilt after a target
+	// is created or moves/grows, so it's a superset, but it lets writes and lookups which don't
+	// touch any target skip walking the lists.
+	mutable std::bitset<MAX_PAGES> m_dst_pages[2];
+	mutable bool m_dst_pages_dirty = true;
 	u64 m_target_memory_usage = 0;
 
+	// Pages whose copy in the device's local memory mirror is current, when sources are decoded on the GPU.
+	std::bitset<MAX_PAGES> m_mirrored_pages;
+
 	int m_expected_src_bp = -1;
 	int m_remembered_src_bp = -1;
 	int m_expected_dst_bp = -1;
@@ -455,6 +465,9 @@ protected:
 	/// Resizes the download texture if needed.
 	bool PrepareDownloadTexture(u32 width, u32 height, GSTexture::Format format, std::unique_ptr<GSDownloadTexture>* tex);
 
+	/// Returns false if no target of the given type can overlap the blocks from bp to end_bp (unwrapped).
+	bool TargetPagesOverlap(int type, u32 bp, u32 end_bp) const;
+
 	HashCacheEntry* LookupHashCache(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA, bool& paltex, const u32* clut, const GSVector2i* lod, SourceRegion region);
 	void RemoveFromHashCache(HashCacheMap::iterator it);
 	void AgeHashCache();
@@ -467,6 +480,11 @@ protected:
 
 	Source* CreateMergedSource(GIFRegTEX0 TEX0, GIFRegTEXA TEXA, SourceRegion region, float scale);
 
+	/// Decodes a rectangle of a source texture from local memory on the GPU, uploading any pages the device's mirror
+	/// is missing first. Returns false if the rectangle has to be decoded on the CPU instead.
+	bool DecodeSourceOnGPU(GSTexture* tex, int level, const GSOffset& off, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA,
+		const GSVector4i& rect, const GSVector4i& dst_offset);
+
 public:
 	GSTextureCache();
 	~GSTextureCache();
@@ -513,6 +531,9 @@ public:
 	Target* FindOverlappingTarget(u32 BP, u32 end_bp) const;
 	Target* FindOverlappingTarget(u32 BP, u32 BW, u32 PSM, GSVector4i rc) const;
 
+	/// Must be called when a target's TBP0 or end block changes outside of the texture cache.
+	__fi void InvalidateTargetPages() { m_dst_pages_dirty = true; }
+
 	GSVector2i GetTargetSize(u32 bp, u32 fbw, u32 psm, s32 min_width, s32 min_height);
 	bool HasTargetInHeightCache(u32 bp, u32 fbw, u32 psm, u32 max_age = std::numeric_limits<u32>::max(), bool move_front = true);
 	bool Has32BitTarget(u32 bp);
@@ -523,6 +544,10 @@ public:
 	void InvalidateVideoMem(const GSOffset& off, const GSVector4i& r, bool target = true);
 	void InvalidateLocalMem(const GSOffset& off, const GSVector4i& r, bool full_flush = false);
 
+	/// Drops pages from the device's local memory mirror. Anything which writes local memory without going through
+	/// InvalidateVideoMem() must call this, otherwise GPU decoded sources will read stale data.
+	void InvalidateMirroredPages(const GSOffset& off, const GSVector4i& r);
+
 	/// Removes any sources which point to the specified target.
 	void InvalidateSourcesFromTarget(const Target* t);
 
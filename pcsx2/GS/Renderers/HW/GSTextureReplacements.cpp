@@ -27,6 +27,7 @@
 #include "common/Console.h"
 #include "common/HashCombine.h"
 #include "common/FileSystem.h"
+#include "common/General.h"
 #include "common/Path.h"
 #include "common/TextureDecompress.h"
 
@@ -43,6 +44,8 @@
 #define TEXTURE_FILENAME_OLD_REGION_FORMAT_STRING "%" PRIx64 "-r%" PRIx64 "-%08x"
 #define TEXTURE_FILENAME_OLD_REGION_CLUT_FORMAT_STRING "%" PRIx64 "-%" PRIx64 "-r%" PRIx64 "-%08x"
 #define TEXTURE_REPLACEMENT_SUBDIRECTORY_NAME "replacements"
+#define TEXTURE_REPLACEMENT_ACCESS_TRACE_NAME "replacement_access.trace"
+#define TEXTURE_REPLACEMENT_PACK_NAME "replacements.pack"
 
 namespace
 {
@@ -84,6 +87,66 @@ namespace
 			unused0 = 0;
 		}
 	};
+
+	/// Header of the per-game access trace, followed by `count` TextureNames in first-use order.
+	struct AccessTraceHeader
+	{
+		static constexpr u32 MAGIC = 0x52544150; // PATR
+		static constexpr u32 VERSION = 1;
+
+		u32 magic;
+		u32 version;
+		u32 count;
+		u32 name_size;
+	};
+
+	// Single-file texture pack, written by tools/build_texture_pack.py from a replacements directory.
+	// The whole file is mapped read-only; entries are sorted by the raw bytes of their TextureName, and point at
+	// payloads which are already in upload format (RGBA8 or BCn, base level followed by any mips), so loading
+	// a texture doesn't read or decode anything up front.
+	static constexpr char TEXTURE_PACK_MAGIC[8] = {'P', 'C', 'S', 'X', '2', 'T', 'P', 'K'};
+	static constexpr u32 TEXTURE_PACK_VERSION = 1;
+	// same limit as the DDS loader
+	static constexpr u32 TEXTURE_PACK_MAX_TEXTURE_SIZE = 32768;
+
+	struct TexturePackHeader
+	{
+		char magic[8];
+		u32 version;
+		u32 count;
+		u64 entries_offset;
+	};
+	static_assert(sizeof(TexturePackHeader) == 24);
+
+	enum class TexturePackFormat : u32
+	{
+		RGBA8,
+		BC1,
+		BC2,
+		BC3,
+		BC7,
+	};
+
+	struct TexturePackEntry
+	{
+		TextureName name;
+		TexturePackFormat format;
+		u32 width;
+		u32 height;
+		u32 pitch;
+		u32 mip_count; // not including the base level
+		u8 alpha_min;
+		u8 alpha_max;
+		u16 reserved;
+		u64 data_offset;
+		u64 data_size;
+	};
+	static_assert(sizeof(TextureName) == 32 && sizeof(TexturePackEntry) == 72);
+
+	/// How many trace entries past the last requested one get queued for prefetching.
+	static constexpr size_t PREFETCH_WINDOW = 64;
+	/// Upper bound on prefetched replacement data which hasn't been requested yet.
+	static constexpr size_t PREFETCH_BUDGET = 256 * _1mb;
 } // namespace
 
 namespace std
@@ -115,6 +178,19 @@ namespace GSTextureReplacements
 	static void QueueAsyncReplacementTextureLoad(const TextureName& name, const std::string& filename, bool mipmap, bool cache_only);
 	static void PrecacheReplacementTextures();
 	static void ClearReplacementTextures();
+	static size_t GetReplacementTextureSize(const ReplacementTexture& rtex);
+
+	static void LoadAccessTrace();
+	static void SaveAccessTrace();
+	static void ClearAccessTrace();
+	static void RecordReplacementAccess(const TextureName& name);
+	static void QueuePrefetchLoads();
+	static void ReleasePrefetchedTexture(const TextureName& name);
+
+	static void OpenTexturePack();
+	static void CloseTexturePack();
+	static const TexturePackEntry* FindTexturePackEntry(const TextureName& name);
+	static GSTexture* LookupTexturePackTexture(const TextureName& name, bool mipmap, std::pair<u8, u8>* alpha_minmax);
 
 	static void StartWorkerThread();
 	static void StopWorkerThread();
@@ -142,11 +218,39 @@ namespace GSTextureReplacements
 	/// Second element is whether the texture should be created with mipmaps.
 	static std::vector<std::pair<TextureName, bool>> s_async_loaded_textures;
 
-	/// Loader/dumper thread.
-	static std::thread s_worker_thread;
+	/// Replacements in the order they were first requested this session, saved per game for prefetching on later runs.
+	static std::vector<TextureName> s_access_trace;
+	static std::unordered_set<TextureName> s_access_trace_seen;
+	static bool s_access_trace_dirty = false;
+
+	/// Trace saved by a previous run, and the position of each name within it.
+	static std::vector<TextureName> s_prefetch_trace;
+	static std::unordered_map<TextureName, size_t> s_prefetch_trace_index;
+	/// One past the furthest trace entry requested so far, and the next entry to queue for prefetching.
+	static size_t s_prefetch_cursor = 0;
+	static size_t s_prefetch_queue_pos = 0;
+
+	/// Textures queued or loaded ahead of time which haven't been requested yet. Protected by the cache mutex.
+	struct PrefetchedTexture
+	{
+		size_t trace_index;
+		size_t size; // file size until the load completes, then the decoded size
+	};
+	static std::unordered_map<TextureName, PrefetchedTexture> s_prefetched_textures;
+	static size_t s_prefetched_bytes = 0;
+
+	/// Memory-mapped texture pack for the current game, if there is one.
+	static u8* s_texture_pack_data = nullptr;
+	static size_t s_texture_pack_size = 0;
+	static const TexturePackEntry* s_texture_pack_entries = nullptr;
+	static u32 s_texture_pack_count = 0;
+
+	/// Loader/dumper threads.
+	static std::vector<std::thread> s_worker_threads;
 	static std::mutex s_worker_thread_mutex;
 	static std::condition_variable s_worker_thread_cv;
 	static std::deque<std::pair<std::function<void()>, bool>> s_worker_thread_queue;
+	static u32 s_worker_thread_active_items = 0; // taken off the queue but not finished yet
 	static bool s_worker_thread_running = false;
 }; // namespace GSTextureReplacements
 
@@ -276,6 +380,7 @@ void GSTextureReplacements::GameChanged()
 	if (s_current_serial == new_serial)
 		return;
 
+	SaveAccessTrace();
 	s_current_serial = std::move(new_serial);
 	ReloadReplacementMap();
 }
@@ -283,27 +388,35 @@ void GSTextureReplacements::GameChanged()
 void GSTextureReplacements::ReloadReplacementMap()
 {
 	SyncWorkerThread();
+	SaveAccessTrace();
 
 	// clear out the caches
 	{
 		s_replacement_texture_filenames.clear();
 		s_replacement_textures_without_clut_hash.clear();
+		ClearAccessTrace();
 
 		std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
 		s_replacement_texture_cache.clear();
 		s_pending_async_load_textures.clear();
 		s_async_loaded_textures.clear();
+		s_prefetched_textures.clear();
+		s_prefetched_bytes = 0;
 	}
+	CloseTexturePack();
 
 	// can't replace bios textures.
 	if (s_current_serial.empty() || !GSConfig.LoadTextureReplacements)
 		return;
 
+	OpenTexturePack();
+
 	const std::string replacement_dir(Path::Combine(GetGameTextureDirectory(), TEXTURE_REPLACEMENT_SUBDIRECTORY_NAME));
 
+	// loose files are still picked up next to a pack, and take priority over it
 	FileSystem::FindResultsArray files;
 	if (!FileSystem::FindFiles(replacement_dir.c_str(), "*", FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE, &files))
-		return;
+		files.clear();
 
 	std::string filename;
 	for (FILESYSTEM_FIND_DATA& fd : files)
@@ -325,10 +438,12 @@ void GSTextureReplacements::ReloadReplacementMap()
 		s_replacement_textures_without_clut_hash.insert(name.value());
 	}
 
-	if (!s_replacement_texture_filenames.empty())
+	if (!s_replacement_texture_filenames.empty() || s_texture_pack_count > 0)
 	{
 		if (GSConfig.PrecacheTextureReplacements)
 			PrecacheReplacementTextures();
+		else if (GSConfig.PrefetchTextureReplacements)
+			LoadAccessTrace();
 
 		// log a warning when paltex is on and preloading is off, since we'll be disabling paltex
 		if (GSConfig.GPUPaletteConversion && GSConfig.TexturePreloading != TexturePreloadingLevel::Full)
@@ -351,9 +466,21 @@ void GSTextureReplacements::UpdateConfig(Pcsx2Config::GSOptions& old_config)
 		CancelPendingLoadsAndDumps();
 
 	if (GSConfig.LoadTextureReplacements && !old_config.LoadTextureReplacements)
+	{
 		ReloadReplacementMap();
+	}
 	else if (!GSConfig.LoadTextureReplacements && old_config.LoadTextureReplacements)
+	{
+		SaveAccessTrace();
 		ClearReplacementTextures();
+	}
+	else if (GSConfig.LoadTextureReplacements && GSConfig.PrefetchTextureReplacements != old_config.PrefetchTextureReplacements)
+	{
+		SaveAccessTrace();
+		ClearAccessTrace();
+		if (GSConfig.PrefetchTextureReplacements && !GSConfig.PrecacheTextureReplacements)
+			LoadAccessTrace();
+	}
 
 	if (GSConfig.LoadTextureReplacements && GSConfig.PrecacheTextureReplacements && !old_config.PrecacheTextureReplacements)
 		PrecacheReplacementTextures();
@@ -363,6 +490,7 @@ void GSTextureReplacements::Shutdown()
 {
 	StopWorkerThread();
 
+	SaveAccessTrace();
 	std::string().swap(s_current_serial);
 	ClearReplacementTextures();
 }
@@ -374,7 +502,7 @@ u32 GSTextureReplacements::CalcMipmapLevelsForReplacement(u32 width, u32 height)
 
 bool GSTextureReplacements::HasAnyReplacementTextures()
 {
-	return !s_replacement_texture_filenames.empty();
+	return !s_replacement_texture_filenames.empty() || s_texture_pack_count > 0;
 }
 
 bool GSTextureReplacements::HasReplacementTextureWithOtherPalette(const GSTextureCache::HashCacheKey& hash)
@@ -392,11 +520,18 @@ GSTexture* GSTextureReplacements::LookupReplacementTexture(const GSTextureCache:
 	// replacement for this name exists?
 	auto fnit = s_replacement_texture_filenames.find(name);
 	if (fnit == s_replacement_texture_filenames.end())
-		return nullptr;
+		return s_texture_pack_entries ? LookupTexturePackTexture(name, mipmap, alpha_minmax) : nullptr;
+
+	if (GSConfig.PrefetchTextureReplacements)
+		RecordReplacementAccess(name);
 
 	// try the full cache first, to avoid reloading from disk
 	{
 		std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
+
+		// no longer counts against the prefetch budget once it's been asked for, loaded or not
+		ReleasePrefetchedTexture(name);
+
 		auto it = s_replacement_texture_cache.find(name);
 		if (it != s_replacement_texture_cache.end())
 		{
@@ -565,6 +700,15 @@ void GSTextureReplacements::QueueAsyncReplacementTextureLoad(const TextureName&
 		// insert into the cache and queue for later injection
 		if (replacement.has_value())
 		{
+			// prefetches were charged with the file size when queued, swap that for what's actually in memory
+			auto pit = s_prefetched_textures.find(name);
+			if (pit != s_prefetched_textures.end())
+			{
+				const size_t size = GetReplacementTextureSize(replacement.value());
+				s_prefetched_bytes = s_prefetched_bytes - pit->second.size + size;
+				pit->second.size = size;
+			}
+
 			s_replacement_texture_cache.emplace(name, std::move(replacement.value()));
 			s_async_loaded_textures.emplace_back(name, mipmap);
 		}
@@ -572,6 +716,7 @@ void GSTextureReplacements::QueueAsyncReplacementTextureLoad(const TextureName&
 		{
 			// loading failed, so clear it from the pending list
 			s_pending_async_load_textures.erase(name);
+			ReleasePrefetchedTexture(name);
 		}
 	}, !cache_only);
 }
@@ -599,11 +744,353 @@ void GSTextureReplacements::ClearReplacementTextures()
 {
 	s_replacement_texture_filenames.clear();
 	s_replacement_textures_without_clut_hash.clear();
+	ClearAccessTrace();
+
+	{
+		std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
+		s_replacement_texture_cache.clear();
+		s_pending_async_load_textures.clear();
+		s_async_loaded_textures.clear();
+		s_prefetched_textures.clear();
+		s_prefetched_bytes = 0;
+	}
+
+	CloseTexturePack();
+}
+
+size_t GSTextureReplacements::GetReplacementTextureSize(const ReplacementTexture& rtex)
+{
+	size_t size = rtex.data.size();
+	for (const ReplacementTexture::MipData& mip : rtex.mips)
+		size += mip.data.size();
+	return size;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Texture Pack
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void GSTextureReplacements::OpenTexturePack()
+{
+	const std::string path(Path::Combine(GetGameTextureDirectory(), TEXTURE_REPLACEMENT_PACK_NAME));
+
+	size_t size = 0;
+	u8* data = static_cast<u8*>(HostSys::MapFileReadOnly(path.c_str(), &size));
+	if (!data)
+		return;
+
+	TexturePackHeader header;
+	bool valid = (size >= sizeof(header));
+	if (valid)
+	{
+		std::memcpy(&header, data, sizeof(header));
+		valid = (std::memcmp(header.magic, TEXTURE_PACK_MAGIC, sizeof(header.magic)) == 0 &&
+				 header.version == TEXTURE_PACK_VERSION &&
+				 (header.entries_offset % alignof(TexturePackEntry)) == 0 &&
+				 header.entries_offset <= size &&
+				 (size - header.entries_offset) / sizeof(TexturePackEntry) >= header.count);
+	}
+
+	if (!valid)
+	{
+		Console.Warning("Ignoring invalid texture pack %s", path.c_str());
+		HostSys::UnmapFile(data, size);
+		return;
+	}
+
+	s_texture_pack_data = data;
+	s_texture_pack_size = size;
+	s_texture_pack_entries = reinterpret_cast<const TexturePackEntry*>(data + header.entries_offset);
+	s_texture_pack_count = header.count;
+
+	// needed for the paltex check, this only touches the index
+	for (u32 i = 0; i < s_texture_pack_count; i++)
+	{
+		TextureName name(s_texture_pack_entries[i].name);
+		name.CLUTHash = 0;
+		s_replacement_textures_without_clut_hash.insert(name);
+	}
+
+	Console.WriteLn("Mapped texture pack %s with %u textures", path.c_str(), s_texture_pack_count);
+}
+
+void GSTextureReplacements::CloseTexturePack()
+{
+	if (!s_texture_pack_data)
+		return;
+
+	HostSys::UnmapFile(s_texture_pack_data, s_texture_pack_size);
+	s_texture_pack_data = nullptr;
+	s_texture_pack_size = 0;
+	s_texture_pack_entries = nullptr;
+	s_texture_pack_count = 0;
+}
+
+const TexturePackEntry* GSTextureReplacements::FindTexturePackEntry(const TextureName& name)
+{
+	const TexturePackEntry* begin = s_texture_pack_entries;
+	const TexturePackEntry* end = s_texture_pack_entries + s_texture_pack_count;
+	const TexturePackEntry* it = std::lower_bound(begin, end, name,
+		[](const TexturePackEntry& entry, const TextureName& name) { return entry.name < name; });
+	return (it != end && it->name == name) ? it : nullptr;
+}
+
+GSTexture* GSTextureReplacements::LookupTexturePackTexture(const TextureName& name, bool mipmap, std::pair<u8, u8>* alpha_minmax)
+{
+	const TexturePackEntry* entry = FindTexturePackEntry(name);
+	if (!entry)
+		return nullptr;
+
+	u32 block_size = 4;
+	u32 bytes_per_block = 16;
+	ReplacementTexture rtex;
+	const GSDevice::FeatureSupport features(g_gs_device->Features());
+	switch (entry->format)
+	{
+		case TexturePackFormat::RGBA8:
+			rtex.format = GSTexture::Format::Color;
+			block_size = 1;
+			bytes_per_block = 4;
+			break;
+		case TexturePackFormat::BC1:
+			rtex.format = GSTexture::Format::BC1;
+			bytes_per_block = 8;
+			break;
+		case TexturePackFormat::BC2:
+			rtex.format = GSTexture::Format::BC2;
+			break;
+		case TexturePackFormat::BC3:
+			rtex.format = GSTexture::Format::BC3;
+			break;
+		case TexturePackFormat::BC7:
+			rtex.format = GSTexture::Format::BC7;
+			break;
+		default:
+			return nullptr;
+	}
+	if ((block_size > 1 && rtex.format != GSTexture::Format::BC7 && !features.dxt_textures) ||
+		(rtex.format == GSTexture::Format::BC7 && !features.bptc_textures))
+	{
+		return nullptr;
+	}
+
+	// the pack was validated as a whole on open, but not the individual payloads
+	const u64 data_end = entry->data_offset + entry->data_size;
+	if (data_end < entry->data_offset || data_end > s_texture_pack_size)
+		return nullptr;
+
+	// the pitch is trusted by the upload, so it has to cover a whole row of blocks
+	if (entry->width == 0 || entry->width >= TEXTURE_PACK_MAX_TEXTURE_SIZE ||
+		entry->height == 0 || entry->height >= TEXTURE_PACK_MAX_TEXTURE_SIZE)
+	{
+		return nullptr;
+	}
+	const u32 row_bytes = std::max(Common::AlignUp(entry->width, block_size) / block_size, 1u) * bytes_per_block;
+	if (entry->pitch < row_bytes)
+		return nullptr;
+
+	const u8* data = s_texture_pack_data + entry->data_offset;
+	u64 offset = static_cast<u64>(entry->pitch) * std::max(Common::AlignUp(entry->height, block_size) / block_size, 1u);
+	if (offset > entry->data_size)
+		return nullptr;
+
+	rtex.width = entry->width;
+	rtex.height = entry->height;
+	rtex.pitch = entry->pitch;
+	rtex.mapped_data = data;
+	rtex.alpha_minmax = std::make_pair(entry->alpha_min, entry->alpha_max);
+
+	if (mipmap)
+	{
+		for (u32 level = 1; level <= entry->mip_count; level++)
+		{
+			ReplacementTexture::MipData md;
+			md.width = std::max<u32>(entry->width >> level, 1u);
+			md.height = std::max<u32>(entry->height >> level, 1u);
+			md.pitch = std::max(Common::AlignUp(md.width, block_size) / block_size, 1u) * bytes_per_block;
+
+			// mips are tightly packed after the base level, stop at the first one the entry can't hold
+			const u64 mip_size = static_cast<u64>(md.pitch) * std::max(Common::AlignUp(md.height, block_size) / block_size, 1u);
+			if (mip_size > entry->data_size - offset)
+				break;
+
+			md.mapped_data = data + offset;
+			offset += mip_size;
+			rtex.mips.push_back(std::move(md));
+		}
+	}
+
+	*alpha_minmax = rtex.alpha_minmax;
+	return CreateReplacementTexture(rtex, mipmap);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Access Trace / Prefetching
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void GSTextureReplacements::LoadAccessTrace()
+{
+	const std::string path(Path::Combine(GetGameTextureDirectory(), TEXTURE_REPLACEMENT_ACCESS_TRACE_NAME));
+	std::optional<std::vector<u8>> data(FileSystem::ReadBinaryFile(path.c_str()));
+	if (!data.has_value())
+		return;
+
+	AccessTraceHeader header;
+	if (data->size() < sizeof(header))
+		return;
+
+	std::memcpy(&header, data->data(), sizeof(header));
+	if (header.magic != AccessTraceHeader::MAGIC || header.version != AccessTraceHeader::VERSION ||
+		header.name_size != sizeof(TextureName) ||
+		data->size() != sizeof(header) + static_cast<size_t>(header.count) * sizeof(TextureName))
+	{
+		Console.Warning("Ignoring invalid replacement access trace %s", path.c_str());
+		return;
+	}
+
+	const u8* ptr = data->data() + sizeof(header);
+	s_prefetch_trace.reserve(header.count);
+	for (u32 i = 0; i < header.count; i++, ptr += sizeof(TextureName))
+	{
+		TextureName name;
+		std::memcpy(&name, ptr, sizeof(name));
+
+		// skip anything which was removed from the pack since the trace was written
+		if (s_replacement_texture_filenames.find(name) == s_replacement_texture_filenames.end() ||
+			!s_prefetch_trace_index.emplace(name, s_prefetch_trace.size()).second)
+		{
+			continue;
+		}
+
+		s_prefetch_trace.push_back(name);
+	}
+
+	Console.WriteLn("Loaded replacement access trace with %zu textures", s_prefetch_trace.size());
+	QueuePrefetchLoads();
+}
+
+void GSTextureReplacements::SaveAccessTrace()
+{
+	if (!s_access_trace_dirty || s_current_serial.empty())
+		return;
+
+	s_access_trace_dirty = false;
+
+	// keep whatever earlier runs saw after this session's order, so a short session doesn't forget the rest of the game
+	std::vector<TextureName> trace(s_access_trace);
+	for (const TextureName& name : s_prefetch_trace)
+	{
+		if (s_access_trace_seen.find(name) == s_access_trace_seen.end())
+			trace.push_back(name);
+	}
+
+	AccessTraceHeader header;
+	header.magic = AccessTraceHeader::MAGIC;
+	header.version = AccessTraceHeader::VERSION;
+	header.count = static_cast<u32>(trace.size());
+	header.name_size = sizeof(TextureName);
+
+	std::vector<u8> data(sizeof(header) + trace.size() * sizeof(TextureName));
+	std::memcpy(data.data(), &header, sizeof(header));
+	std::memcpy(data.data() + sizeof(header), trace.data(), trace.size() * sizeof(TextureName));
+
+	const std::string path(Path::Combine(GetGameTextureDirectory(), TEXTURE_REPLACEMENT_ACCESS_TRACE_NAME));
+	if (!FileSystem::WriteBinaryFile(path.c_str(), data.data(), data.size()))
+		Console.Warning("Failed to write replacement access trace %s", path.c_str());
+}
+
+void GSTextureReplacements::ClearAccessTrace()
+{
+	s_access_trace.clear();
+	s_access_trace_seen.clear();
+	s_access_trace_dirty = false;
+	s_prefetch_trace.clear();
+	s_prefetch_trace_index.clear();
+	s_prefetch_cursor = 0;
+	s_prefetch_queue_pos = 0;
+}
+
+void GSTextureReplacements::RecordReplacementAccess(const TextureName& name)
+{
+	if (s_access_trace_seen.insert(name).second)
+	{
+		s_access_trace.push_back(name);
+		s_access_trace_dirty = true;
+	}
+
+	if (s_prefetch_trace.empty())
+		return;
+
+	// move the prefetch window along if the game is further into the trace than before
+	const auto it = s_prefetch_trace_index.find(name);
+	if (it != s_prefetch_trace_index.end() && it->second >= s_prefetch_cursor)
+	{
+		s_prefetch_cursor = it->second + 1;
+
+		// anything the game skipped past was a wrong guess, so drop it rather than letting it hold the budget.
+		// the entry just requested is released by the lookup instead.
+		std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
+		for (auto pit = s_prefetched_textures.begin(); pit != s_prefetched_textures.end();)
+		{
+			if (pit->second.trace_index >= it->second)
+			{
+				++pit;
+				continue;
+			}
+
+			// still loading? dropping it from the pending list makes the loader throw it away
+			s_pending_async_load_textures.erase(pit->first);
+			s_replacement_texture_cache.erase(pit->first);
+			s_prefetched_bytes -= pit->second.size;
+			pit = s_prefetched_textures.erase(pit);
+		}
+	}
+
+	QueuePrefetchLoads();
+}
+
+void GSTextureReplacements::QueuePrefetchLoads()
+{
+	// same guess as precaching, the request will reload with mips if we got it wrong
+	const bool mipmap = (GSConfig.HWMipmapMode >= GSHWMipmapMode::Enabled || GSConfig.TriFilter == TriFiltering::Forced);
+
+	s_prefetch_queue_pos = std::max(s_prefetch_queue_pos, s_prefetch_cursor);
+	const size_t end = std::min(s_prefetch_trace.size(), s_prefetch_cursor + PREFETCH_WINDOW);
+	if (s_prefetch_queue_pos >= end)
+		return;
 
 	std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
-	s_replacement_texture_cache.clear();
-	s_pending_async_load_textures.clear();
-	s_async_loaded_textures.clear();
+	for (; s_prefetch_queue_pos < end && s_prefetched_bytes < PREFETCH_BUDGET; s_prefetch_queue_pos++)
+	{
+		const TextureName& name = s_prefetch_trace[s_prefetch_queue_pos];
+		if (s_replacement_texture_cache.find(name) != s_replacement_texture_cache.end() ||
+			s_pending_async_load_textures.find(name) != s_pending_async_load_textures.end())
+		{
+			continue;
+		}
+
+		const auto fnit = s_replacement_texture_filenames.find(name);
+		if (fnit == s_replacement_texture_filenames.end())
+			continue;
+
+		// charge the load now, so a window of queued loads can't run past the budget before any of them finish.
+		// the file size is only an estimate, the loader corrects it once the texture is decoded.
+		struct stat st;
+		const size_t size = FileSystem::StatFile(fnit->second.c_str(), &st) ? static_cast<size_t>(st.st_size) : 0;
+		s_prefetched_textures.emplace(name, PrefetchedTexture{s_prefetch_queue_pos, size});
+		s_prefetched_bytes += size;
+		QueueAsyncReplacementTextureLoad(name, fnit->second, mipmap, true);
+	}
+}
+
+void GSTextureReplacements::ReleasePrefetchedTexture(const TextureName& name)
+{
+	const auto it = s_prefetched_textures.find(name);
+	if (it == s_prefetched_textures.end())
+		return;
+
+	s_prefetched_bytes -= it->second.size;
+	s_prefetched_textures.erase(it);
 }
 
 GSTexture* GSTextureReplacements::CreateReplacementTexture(const ReplacementTexture& rtex, bool mipmap)
@@ -629,7 +1116,7 @@ GSTexture* GSTextureReplacements::CreateReplacementTexture(const ReplacementText
 		return nullptr;
 
 	// upload base level
-	tex->Update(GSVector4i(0, 0, rtex.width, rtex.height), rtex.data.data(), rtex.pitch);
+	tex->Update(GSVector4i(0, 0, rtex.width, rtex.height), rtex.GetData(), rtex.pitch);
 
 	// and the mips if they're present in the replacement texture
 	if (!rtex.mips.empty())
@@ -637,7 +1124,7 @@ GSTexture* GSTextureReplacements::CreateReplacementTexture(const ReplacementText
 		for (u32 i = 0; i < static_cast<u32>(rtex.mips.size()); i++)
 		{
 			const ReplacementTexture::MipData& mip = rtex.mips[i];
-			tex->Update(GSVector4i(0, 0, static_cast<int>(mip.width), static_cast<int>(mip.height)), mip.data.data(), mip.pitch, i + 1);
+			tex->Update(GSVector4i(0, 0, static_cast<int>(mip.width), static_cast<int>(mip.height)), mip.GetData(), mip.pitch, i + 1);
 		}
 	}
 
@@ -683,25 +1170,30 @@ void GSTextureReplacements::StartWorkerThread()
 {
 	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
 
-	if (s_worker_thread.joinable())
+	if (!s_worker_threads.empty())
 		return;
 
+	// decoding large replacements is mostly CPU bound, so a few loaders keep prefetching ahead of the game
+	const u32 num_threads = std::clamp(std::thread::hardware_concurrency() / 4u, 1u, 4u);
 	s_worker_thread_running = true;
-	s_worker_thread = std::thread(WorkerThreadEntryPoint);
+	for (u32 i = 0; i < num_threads; i++)
+		s_worker_threads.emplace_back(WorkerThreadEntryPoint);
 }
 
 void GSTextureReplacements::StopWorkerThread()
 {
 	{
 		std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-		if (!s_worker_thread.joinable())
+		if (s_worker_threads.empty())
 			return;
 
 		s_worker_thread_running = false;
-		s_worker_thread_cv.notify_one();
+		s_worker_thread_cv.notify_all();
 	}
 
-	s_worker_thread.join();
+	for (std::thread& thread : s_worker_threads)
+		thread.join();
+	s_worker_threads.clear();
 
 	// clear out workery-things too
 	CancelPendingLoadsAndDumps();
@@ -757,22 +1249,25 @@ void GSTextureReplacements::WorkerThreadEntryPoint()
 
 		std::function<void()> fn = std::move(s_worker_thread_queue.front().first);
 		s_worker_thread_queue.pop_front();
+		s_worker_thread_active_items++;
 		lock.unlock();
 		fn();
 		lock.lock();
+		s_worker_thread_active_items--;
 	}
 }
 
 void GSTextureReplacements::SyncWorkerThread()
 {
 	std::unique_lock<std::mutex> lock(s_worker_thread_mutex);
-	if (!s_worker_thread.joinable())
+	if (s_worker_threads.empty())
 		return;
 
 	// not the most efficient by far, but it only gets called on config changes, so whatever
+	// items which another loader already picked up can still be publishing their results, so wait for those too
 	for (;;)
 	{
-		if (s_worker_thread_queue.empty())
+		if (s_worker_thread_queue.empty() && s_worker_thread_active_items == 0)
 			break;
 
 		lock.unlock();
@@ -30,6 +30,8 @@ namespace GSTextureReplacements
 
 		u32 pitch;
 		std::vector<u8> data;
+		/// Used instead of `data` when the texture comes straight out of a memory-mapped texture pack.
+		const u8* mapped_data = nullptr;
 
 		struct MipData
 		{
@@ -37,8 +39,13 @@ namespace GSTextureReplacements
 			u32 height;
 			u32 pitch;
 			std::vector<u8> data;
+			const u8* mapped_data = nullptr;
+
+			const u8* GetData() const { return mapped_data ? mapped_data : data.data(); }
 		};
 		std::vector<MipData> mips;
+
+		const u8* GetData() const { return mapped_data ? mapped_data : data.data(); }
 	};
 
 	void Initialize();
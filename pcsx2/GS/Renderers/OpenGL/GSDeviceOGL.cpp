@@ -33,6 +33,7 @@
 #include "ShaderCacheVersion.h"
 
 #include "convert.glsl"
+#include "decode.glsl"
 #include "interlace.glsl"
 #include "present.glsl"
 #include "merge.glsl"
@@ -242,6 +243,7 @@ bool GSDeviceOGL::CheckFeatures(bool& buggy_pbo)
 		Console.Warning("GL_ARB_clip_control is not supported, this will cause rendering issues.");
 	m_features.stencil_buffer = true;
 	m_features.test_and_sample_depth = m_features.texture_barrier;
+	m_features.local_memory_decode = GSConfig.GPUTextureDecode && GLAD_GL_VERSION_4_3;
 
 	// NVIDIA GPUs prior to Kepler appear to have broken vertex shader buffer loading.
 	// Use bindless textures (introduced in Kepler) to differentiate.
@@ -516,6 +518,37 @@ bool GSDeviceOGL::Create()
 		}
 	}
 
+	// ****************************************************************
+	// local memory decode
+	// ****************************************************************
+	if (m_features.local_memory_decode)
+	{
+		const std::string cs = fmt::format("#version 430 core\n#define CLUT_OFFSET {}u\n", LOCAL_MEMORY_CLUT_OFFSET) +
+							   decode_glsl_shader_raw;
+		if (m_shader_cache.GetComputeProgram(&m_local_memory_decode.cs, cs))
+		{
+			m_local_memory_decode.cs.RegisterUniform("SrcRect");
+			m_local_memory_decode.cs.RegisterUniform("DstOffset");
+			m_local_memory_decode.cs.RegisterUniform("Params0");
+			m_local_memory_decode.cs.RegisterUniform("Params1");
+
+			// Local memory and the CLUT are filled in as they're used, the swizzle tables never change.
+			std::unique_ptr<u32[]> tables = std::make_unique<u32[]>(LOCAL_MEMORY_SWIZZLE_SIZE);
+			GenerateLocalMemorySwizzleTables(tables.get());
+			glGenBuffers(1, &m_local_memory_decode.buffer);
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_local_memory_decode.buffer);
+			glBufferData(GL_SHADER_STORAGE_BUFFER, LOCAL_MEMORY_BUFFER_SIZE, nullptr, GL_DYNAMIC_DRAW);
+			glBufferSubData(GL_SHADER_STORAGE_BUFFER, LOCAL_MEMORY_SWIZZLE_OFFSET * sizeof(u32),
+				LOCAL_MEMORY_SWIZZLE_SIZE * sizeof(u32), tables.get());
+			glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, m_local_memory_decode.buffer);
+		}
+		else
+		{
+			Console.Warning("Failed to compile local memory decode shader, textures will be decoded on the CPU.");
+			m_features.local_memory_decode = false;
+		}
+	}
+
 	// ****************************************************************
 	// rasterization configuration
 	// ****************************************************************
@@ -644,6 +677,10 @@ void GSDeviceOGL::DestroyResources()
 	for (GLProgram& prog : m_merge_obj.ps)
 		prog.Destroy();
 
+	m_local_memory_decode.cs.Destroy();
+	if (m_local_memory_decode.buffer != 0)
+		glDeleteBuffers(1, &m_local_memory_decode.buffer);
+
 	m_fragment_uniform_stream_buffer.reset();
 	m_vertex_uniform_stream_buffer.reset();
 
@@ -1358,6 +1395,57 @@ void GSDeviceOGL::FilteredDownsampleTexture(GSTexture* sTex, GSTexture* dTex, u3
 	DrawStretchRect(GSVector4::zero(), dRect, dTex->GetSize());
 }
 
+bool GSDeviceOGL::UpdateLocalMemoryPages(const u8* vm, const u32* pages, u32 num_pages)
+{
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_local_memory_decode.buffer);
+
+	// Upload runs of consecutive pages together, textures usually cover several.
+	for (u32 i = 0; i < num_pages;)
+	{
+		u32 count = 1;
+		while ((i + count) < num_pages && pages[i + count] == (pages[i] + count))
+			count++;
+
+		glBufferSubData(GL_SHADER_STORAGE_BUFFER, pages[i] * PAGE_SIZE, count * PAGE_SIZE, vm + pages[i] * PAGE_SIZE);
+		i += count;
+	}
+
+	return true;
+}
+
+bool GSDeviceOGL::DecodeLocalMemory(GSTexture* dTex, int level, const LocalMemoryDecodeConstantBuffer& cb, const u32* clut)
+{
+	if (dTex->GetFormat() != GSTexture::Format::Color)
+		return false;
+	if (level >= dTex->GetMipmapLevels())
+		return true;
+
+	CommitClear(dTex, true);
+
+	if (const u32 clut_size = cb.GetCLUTSize(); clut_size > 0)
+	{
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_local_memory_decode.buffer);
+		glBufferSubData(GL_SHADER_STORAGE_BUFFER, LOCAL_MEMORY_CLUT_OFFSET * sizeof(u32), clut_size * sizeof(u32), clut);
+	}
+
+	const GLProgram& prog = m_local_memory_decode.cs;
+	prog.Bind();
+	prog.Uniform4uiv(0, cb.SrcRect.U32);
+	prog.Uniform4uiv(1, cb.DstOffset.U32);
+	prog.Uniform4uiv(2, &cb.BP);
+	prog.Uniform4uiv(3, &cb.PageShift);
+
+	glBindImageTexture(0, static_cast<GSTextureOGL*>(dTex)->GetID(), level, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+	glDispatchCompute((cb.SrcRect.z + 7) / 8, (cb.SrcRect.w + 7) / 8, 1);
+	glBindImageTexture(0, 0, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+
+	// Make the writes visible to sampling, copies and render targets.
+	glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT | GL_FRAMEBUFFER_BARRIER_BIT);
+
+	dTex->SetMipmapGenerationFlag(level);
+	return true;
+}
+
 void GSDeviceOGL::DrawStretchRect(const GSVector4& sRect, const GSVector4& dRect, const GSVector2i& ds)
 {
 	// Original code from DX
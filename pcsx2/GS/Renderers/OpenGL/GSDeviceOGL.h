@@ -202,6 +202,12 @@ private:
 
 	GLProgram m_present[static_cast<int>(PresentShader::Count)];
 
+	struct
+	{
+		GLProgram cs;
+		GLuint buffer = 0; // local memory, CLUT and swizzle tables
+	} m_local_memory_decode;
+
 	struct
 	{
 		GSDepthStencilOGL* dss = nullptr;
@@ -277,6 +283,8 @@ public:
 	void UpdateCLUTTexture(GSTexture* sTex, float sScale, u32 offsetX, u32 offsetY, GSTexture* dTex, u32 dOffset, u32 dSize) override;
 	void ConvertToIndexedTexture(GSTexture* sTex, float sScale, u32 offsetX, u32 offsetY, u32 SBW, u32 SPSM, GSTexture* dTex, u32 DBW, u32 DPSM) override;
 	void FilteredDownsampleTexture(GSTexture* sTex, GSTexture* dTex, u32 downsample_factor, const GSVector2i& clamp_min, const GSVector4 &dRect) override;
+	bool UpdateLocalMemoryPages(const u8* vm, const u32* pages, u32 num_pages) override;
+	bool DecodeLocalMemory(GSTexture* dTex, int level, const LocalMemoryDecodeConstantBuffer& cb, const u32* clut) override;
 
 	void DrawMultiStretchRects(const MultiStretchRect* rects, u32 num_rects, GSTexture* dTex, ShaderConvert shader) override;
 	void DoMultiStretchRects(const MultiStretchRect* rects, u32 num_rects, const GSVector2& ds);
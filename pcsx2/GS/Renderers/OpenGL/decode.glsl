@@ -0,0 +1,121 @@
+static const char decode_glsl_shader_raw[] = 
+"layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;\n"
+"\n"
+"uniform uvec4 SrcRect;\n"
+"uniform uvec4 DstOffset;\n"
+"uniform uvec4 Params0;\n"
+"uniform uvec4 Params1;\n"
+"\n"
+"layout(std430, binding = 3) readonly buffer LocalMemory\n"
+"{\n"
+"	uint vm[];\n"
+"};\n"
+"\n"
+"layout(binding = 0, rgba8) uniform writeonly image2D DstTexture;\n"
+"\n"
+"// Decodes textures from a mirror of GS local memory.\n"
+"// The buffer holds local memory, then the CLUT at CLUT_OFFSET, then the in-page swizzle tables.\n"
+"// CLUT_OFFSET is defined by the host, see GSDevice::LOCAL_MEMORY_CLUT_OFFSET.\n"
+"\n"
+"#define MODE_32 0u\n"
+"#define MODE_24 1u\n"
+"#define MODE_16 2u\n"
+"#define MODE_8 3u\n"
+"#define MODE_4 4u\n"
+"#define MODE_8H 5u\n"
+"#define MODE_4HL 6u\n"
+"#define MODE_4HH 7u\n"
+"\n"
+"#define BP Params0.x\n"
+"#define BW_PAGES Params0.y\n"
+"#define MODE Params0.z\n"
+"#define TABLE_OFFSET Params0.w\n"
+"#define PAGE_SHIFT Params1.x\n"
+"#define ADDRESS_XOR Params1.y\n"
+"#define TEXA Params1.z\n"
+"#define ADDRESS_MASK Params1.w\n"
+"\n"
+"uint texel_address(uvec2 pos)\n"
+"{\n"
+"	uint shift_x = PAGE_SHIFT & 0xFFu;\n"
+"	uint shift_y = PAGE_SHIFT >> 8;\n"
+"	uvec2 mask = (uvec2(1u) << uvec2(shift_x, shift_y)) - 1u;\n"
+"\n"
+"	uint page = (pos.y >> shift_y) * BW_PAGES + (pos.x >> shift_x);\n"
+"	uint base = (BP << (shift_x + shift_y - 5u)) + (page << (shift_x + shift_y));\n"
+"	uint offset = vm[TABLE_OFFSET + ((pos.y & mask.y) << shift_x) + (pos.x & mask.x)];\n"
+"	return ((base + offset) ^ ADDRESS_XOR) & ADDRESS_MASK;\n"
+"}\n"
+"\n"
+"uint read16(uint addr)\n"
+"{\n"
+"	return (vm[addr >> 1] >> ((addr & 1u) << 4)) & 0xFFFFu;\n"
+"}\n"
+"\n"
+"uint read8(uint addr)\n"
+"{\n"
+"	return (vm[addr >> 2] >> ((addr & 3u) << 3)) & 0xFFu;\n"
+"}\n"
+"\n"
+"uint read4(uint addr)\n"
+"{\n"
+"	return (vm[addr >> 3] >> ((addr & 7u) << 2)) & 0xFu;\n"
+"}\n"
+"\n"
+"uint clut(uint index)\n"
+"{\n"
+"	return vm[CLUT_OFFSET + index];\n"
+"}\n"
+"\n"
+"uint decode_texel(uint addr)\n"
+"{\n"
+"	uint ta0 = TEXA & 0xFFu;\n"
+"	uint ta1 = (TEXA >> 8) & 0xFFu;\n"
+"	bool aem = (TEXA & 0x10000u) != 0u;\n"
+"\n"
+"	switch (MODE)\n"
+"	{\n"
+"		case MODE_24:\n"
+"		{\n"
+"			uint c = vm[addr] & 0xFFFFFFu;\n"
+"			return c | (((aem && c == 0u) ? 0u : ta0) << 24);\n"
+"		}\n"
+"\n"
+"		case MODE_16:\n"
+"		{\n"
+"			uint c = read16(addr);\n"
+"			uint rgb = ((c & 0x1Fu) << 3) | ((c & 0x3E0u) << 6) | ((c & 0x7C00u) << 9);\n"
+"			uint a = ((c & 0x8000u) != 0u) ? ta1 : ((aem && c == 0u) ? 0u : ta0);\n"
+"			return rgb | (a << 24);\n"
+"		}\n"
+"\n"
+"		case MODE_8:\n"
+"			return clut(read8(addr));\n"
+"\n"
+"		case MODE_4:\n"
+"			return clut(read4(addr));\n"
+"\n"
+"		case MODE_8H:\n"
+"			return clut(vm[addr] >> 24);\n"
+"\n"
+"		case MODE_4HL:\n"
+"			return clut((vm[addr] >> 24) & 0xFu);\n"
+"\n"
+"		case MODE_4HH:\n"
+"			return clut(vm[addr] >> 28);\n"
+"\n"
+"		default:\n"
+"			return vm[addr];\n"
+"	}\n"
+"}\n"
+"\n"
+"void main()\n"
+"{\n"
+"	uvec2 pos = gl_GlobalInvocationID.xy;\n"
+"	if (any(greaterThanEqual(pos, SrcRect.zw)))\n"
+"		return;\n"
+"\n"
+"	uint c = decode_texel(texel_address(SrcRect.xy + pos));\n"
+"	imageStore(DstTexture, ivec2(DstOffset.xy + pos), unpackUnorm4x8(c));\n"
+"}\n"
+;
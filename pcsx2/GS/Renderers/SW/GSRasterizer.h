@@ -55,6 +55,9 @@ private:
 				break;
 			while (m_queue.consume_one(*this))
 				;
+
+			// Items free their vertex heap allocations, don't keep them batched up while we sleep.
+			GSRingHeap::flushFrees();
 		}
 
 		if (m_shutdown)
@@ -16,6 +16,7 @@
 #include <cstring> /* memcpy/memset */
 
 #include "GSRendererSW.h"
+#include "PerformanceMetrics.h"
 
 MULTI_ISA_UNSHARED_IMPL;
 
@@ -79,6 +80,10 @@ void GSRendererSW::VSync(u32 field, bool registers_written, bool idle_frame)
 {
 	Sync(0); // IncAge might delete a cached texture in use
 
+	const GSRingHeap::Stats& heap_stats = m_vertex_heap.getStats();
+	PerformanceMetrics::SetGSHeapStats({heap_stats.allocations, heap_stats.bytes_allocated,
+		heap_stats.buffer_grows, heap_stats.buffer_size});
+
 	GSRenderer::VSync(field, registers_written, idle_frame);
 
 	m_tc->IncAge();
@@ -51,6 +51,7 @@ extern retro_video_refresh_t video_cb;
 #include <libretro_vulkan.h>
 
 #include "convert.glsl"
+#include "decode.glsl"
 #include "interlace.glsl"
 #include "merge.glsl"
 #include "tfx.glsl"
@@ -220,7 +221,7 @@ enum : u32
 	MAX_DRAW_CALLS_PER_FRAME = 8192,
 	MAX_COMBINED_IMAGE_SAMPLER_DESCRIPTORS_PER_FRAME = 2 * MAX_DRAW_CALLS_PER_FRAME,
 	MAX_SAMPLED_IMAGE_DESCRIPTORS_PER_FRAME = MAX_DRAW_CALLS_PER_FRAME, // assume at least half our draws aren't going to be shuffle/blending
-	MAX_STORAGE_IMAGE_DESCRIPTORS_PER_FRAME = 4, // Currently used by CAS only
+	MAX_STORAGE_IMAGE_DESCRIPTORS_PER_FRAME = 1024, // Used by CAS and local memory decodes
 	MAX_INPUT_ATTACHMENT_IMAGE_DESCRIPTORS_PER_FRAME = MAX_DRAW_CALLS_PER_FRAME,
 	MAX_DESCRIPTOR_SETS_PER_FRAME = MAX_DRAW_CALLS_PER_FRAME * 2
 };
@@ -663,7 +664,7 @@ static void SafeDestroyDescriptorSetLayout(VkDevice dev, VkDescriptorSetLayout&
 	{
 		static constexpr const VkDescriptorPoolSize pool_sizes[] = {
 			{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 2},
-			{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2},
+			{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 3},
 		};
 
 		VkDescriptorPoolCreateInfo pool_create_info =  {VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
@@ -1048,7 +1049,7 @@ static void SafeDestroyDescriptorSetLayout(VkDevice dev, VkDescriptorSetLayout&
 	bool GSDeviceVK::AllocatePreinitializedGPUBuffer(u32 size, VkBuffer* gpu_buffer, VmaAllocation* gpu_allocation,
 		VkBufferUsageFlags gpu_usage, const std::function<void(void*)>& fill_callback)
 	{
-		// Try to place the fixed index buffer in GPU local memory.
+		// Try to place the fixed buffer in GPU local memory.
 		// Use the staging buffer to copy into it.
 
 		const VkBufferCreateInfo cpu_bci = {
@@ -1070,7 +1071,7 @@ static void SafeDestroyDescriptorSetLayout(VkDevice dev, VkDescriptorSetLayout&
 			VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
 			nullptr,
 			0, size,
-			VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_SHARING_MODE_EXCLUSIVE};
+			gpu_usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_SHARING_MODE_EXCLUSIVE};
 		const VmaAllocationCreateInfo gpu_aci = {
 			0, VMA_MEMORY_USAGE_GPU_ONLY, 0, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT};
 		VmaAllocationInfo ai;
@@ -1227,6 +1228,12 @@ bool GSDeviceVK::Create()
 		return false;
 	}
 
+	if (m_features.local_memory_decode && !CompileLocalMemoryDecodePipeline())
+	{
+		Console.Warning("Failed to compile local memory decode pipeline, textures will be decoded on the CPU.");
+		m_features.local_memory_decode = false;
+	}
+
 	if (!CreatePersistentDescriptorSets())
 	{
 		Console.Error("Failed to create persistent descriptor sets");
@@ -1406,6 +1413,25 @@ bool GSDeviceVK::CheckFeatures()
 	if (!m_optional_extensions.vk_ext_line_rasterization)
 		Console.WriteLn("VK_EXT_line_rasterization or the BRESENHAM mode is not supported, this may cause rendering inaccuracies.");
 
+	// Decoding textures from local memory needs compute on the graphics queue, and storage writes to RGBA8.
+	if (GSConfig.GPUTextureDecode)
+	{
+		u32 queue_family_count = 0;
+		vkGetPhysicalDeviceQueueFamilyProperties(vk_init_info.gpu, &queue_family_count, nullptr);
+		std::vector<VkQueueFamilyProperties> queue_family_properties(queue_family_count);
+		vkGetPhysicalDeviceQueueFamilyProperties(vk_init_info.gpu, &queue_family_count, queue_family_properties.data());
+
+		VkFormatProperties props = {};
+		vkGetPhysicalDeviceFormatProperties(vk_init_info.gpu, LookupNativeFormat(GSTexture::Format::Color), &props);
+
+		m_features.local_memory_decode =
+			(m_graphics_queue_family_index < queue_family_count &&
+				(queue_family_properties[m_graphics_queue_family_index].queueFlags & VK_QUEUE_COMPUTE_BIT) != 0 &&
+				(props.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT) != 0);
+		if (!m_features.local_memory_decode)
+			Console.Warning("Compute texture decoding is not supported, textures will be decoded on the CPU.");
+	}
+
 	// Test for D32S8 support.
 	{
 		VkFormatProperties props = {};
@@ -1899,6 +1925,120 @@ void GSDeviceVK::FilteredDownsampleTexture(GSTexture* sTex, GSTexture* dTex, u32
 		m_convert[static_cast<int>(shader)], false, true);
 }
 
+static void LocalMemoryBufferBarrier(VkCommandBuffer cmdbuf, VkPipelineStageFlags src_stage, VkAccessFlags src_access,
+	VkPipelineStageFlags dst_stage, VkAccessFlags dst_access)
+{
+	const VkMemoryBarrier barrier = {VK_STRUCTURE_TYPE_MEMORY_BARRIER, nullptr, src_access, dst_access};
+	vkCmdPipelineBarrier(cmdbuf, src_stage, dst_stage, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+bool GSDeviceVK::UpdateLocalMemoryPages(const u8* vm, const u32* pages, u32 num_pages)
+{
+	const u32 size = num_pages * PAGE_SIZE;
+	if (!m_texture_upload_buffer.ReserveMemory(size, GetBufferCopyOffsetAlignment()))
+	{
+		ExecuteCommandBuffer(false);
+		if (!m_texture_upload_buffer.ReserveMemory(size, GetBufferCopyOffsetAlignment()))
+		{
+			Console.Error("Failed to reserve local memory upload memory (%u bytes).", size);
+			return false;
+		}
+	}
+
+	// Runs of consecutive pages are copied with a single region.
+	u8* const staging = static_cast<u8*>(m_texture_upload_buffer.GetCurrentHostPointer());
+	const u32 staging_offset = m_texture_upload_buffer.GetCurrentOffset();
+	std::array<VkBufferCopy, MAX_PAGES> regions;
+	u32 num_regions = 0;
+	for (u32 i = 0; i < num_pages; i++)
+	{
+		const u32 offset = pages[i] * PAGE_SIZE;
+		std::memcpy(staging + i * PAGE_SIZE, vm + offset, PAGE_SIZE);
+
+		if (num_regions > 0 && (regions[num_regions - 1].dstOffset + regions[num_regions - 1].size) == offset)
+			regions[num_regions - 1].size += PAGE_SIZE;
+		else
+			regions[num_regions++] = {staging_offset + i * PAGE_SIZE, offset, PAGE_SIZE};
+	}
+	m_texture_upload_buffer.CommitMemory(size);
+
+	// Earlier decodes may still be reading the old contents, and earlier copies (including the initial fill) may not
+	// have been followed by a decode, so order against both.
+	const VkCommandBuffer cmdbuf = GetCurrentInitCommandBuffer();
+	LocalMemoryBufferBarrier(cmdbuf, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
+	vkCmdCopyBuffer(cmdbuf, m_texture_upload_buffer.GetBuffer(), m_local_memory_buffer, num_regions, regions.data());
+	return true;
+}
+
+bool GSDeviceVK::DecodeLocalMemory(GSTexture* dTex, int level, const LocalMemoryDecodeConstantBuffer& cb, const u32* clut)
+{
+	GSTextureVK* const tex = static_cast<GSTextureVK*>(dTex);
+	if (tex->GetType() != GSTexture::Type::Texture || tex->GetFormat() != GSTexture::Format::Color)
+		return false;
+	if (level >= tex->GetMipmapLevels())
+		return true;
+
+	// Decodes go in the init command buffer along with the page uploads, which executes before any draws. So we
+	// can't use it for a texture which has already been drawn with, the upload path handles that case.
+	if (tex->m_use_fence_counter == GetCurrentFenceCounter())
+		return false;
+
+	if (const u32 clut_size = cb.GetCLUTSize(); clut_size > 0)
+	{
+		const u32 size = clut_size * sizeof(u32);
+		if (!m_texture_upload_buffer.ReserveMemory(size, GetBufferCopyOffsetAlignment()))
+			return false;
+
+		std::memcpy(m_texture_upload_buffer.GetCurrentHostPointer(), clut, size);
+		const VkBufferCopy region = {m_texture_upload_buffer.GetCurrentOffset(), LOCAL_MEMORY_CLUT_OFFSET * sizeof(u32), size};
+		m_texture_upload_buffer.CommitMemory(size);
+
+		const VkCommandBuffer cmdbuf = GetCurrentInitCommandBuffer();
+		LocalMemoryBufferBarrier(cmdbuf, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
+		vkCmdCopyBuffer(cmdbuf, m_texture_upload_buffer.GetBuffer(), m_local_memory_buffer, 1, &region);
+	}
+
+	const VkDescriptorSet ds = AllocateDescriptorSet(m_local_memory_image_ds_layout);
+	if (ds == VK_NULL_HANDLE)
+		return false;
+
+	// Storage images are bound one level at a time.
+	VkImageView view = tex->GetView();
+	if (tex->GetMipmapLevels() > 1)
+	{
+		const VkImageViewCreateInfo vci = {VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO, nullptr, 0, tex->GetImage(),
+			VK_IMAGE_VIEW_TYPE_2D, tex->GetVkFormat(),
+			{VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY,
+				VK_COMPONENT_SWIZZLE_IDENTITY},
+			{VK_IMAGE_ASPECT_COLOR_BIT, static_cast<u32>(level), 1, 0, 1}};
+		if (vkCreateImageView(vk_init_info.device, &vci, nullptr, &view) != VK_SUCCESS)
+			return false;
+		DeferImageViewDestruction(view);
+	}
+
+	Vulkan::DescriptorSetUpdateBuilder dsub;
+	dsub.AddStorageImageDescriptorWrite(ds, 0, view);
+	dsub.Update(vk_init_info.device);
+
+	const VkCommandBuffer cmdbuf = GetCurrentInitCommandBuffer();
+	LocalMemoryBufferBarrier(cmdbuf, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+		VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+	tex->TransitionToLayout(cmdbuf, GSTextureVK::Layout::ComputeReadWriteImage);
+
+	const VkDescriptorSet sets[] = {m_local_memory_descriptor_set, ds};
+	vkCmdBindPipeline(cmdbuf, VK_PIPELINE_BIND_POINT_COMPUTE, m_local_memory_decode_pipeline);
+	vkCmdBindDescriptorSets(cmdbuf, VK_PIPELINE_BIND_POINT_COMPUTE, m_local_memory_pipeline_layout, 0,
+		static_cast<u32>(std::size(sets)), sets, 0, nullptr);
+	vkCmdPushConstants(cmdbuf, m_local_memory_pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(cb), &cb);
+	vkCmdDispatch(cmdbuf, (cb.SrcRect.z + 7) / 8, (cb.SrcRect.w + 7) / 8, 1);
+
+	tex->TransitionToLayout(cmdbuf, GSTextureVK::Layout::ShaderReadOnly);
+	tex->SetMipmapGenerationFlag(level);
+	return true;
+}
+
 void GSDeviceVK::DoMerge(GSTexture* sTex[3], GSVector4* sRect, GSTexture* dTex, GSVector4* dRect,
 	const GSRegPMODE& PMODE, const GSRegEXTBUF& EXTBUF, u32 c, const bool linear)
 {
@@ -2424,6 +2564,18 @@ bool GSDeviceVK::CreateBuffers()
 		return false;
 	}
 
+	// Local memory and the CLUT are filled in as they're used, the swizzle tables never change.
+	if (m_features.local_memory_decode &&
+		!AllocatePreinitializedGPUBuffer(LOCAL_MEMORY_BUFFER_SIZE, &m_local_memory_buffer,
+			&m_local_memory_buffer_allocation, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, [](void* data) {
+				std::memset(data, 0, LOCAL_MEMORY_SWIZZLE_OFFSET * sizeof(u32));
+				GenerateLocalMemorySwizzleTables(static_cast<u32*>(data) + LOCAL_MEMORY_SWIZZLE_OFFSET);
+			}))
+	{
+		Console.Error("Failed to allocate local memory buffer");
+		return false;
+	}
+
 	SetIndexBuffer(m_index_stream_buffer.GetBuffer());
 	return true;
 }
@@ -2475,6 +2627,26 @@ bool GSDeviceVK::CreatePipelineLayouts()
 	plb.AddDescriptorSet(m_tfx_rt_texture_ds_layout);
 	if ((m_tfx_pipeline_layout = plb.Create(dev)) == VK_NULL_HANDLE)
 		return false;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Local Memory Decode Pipeline Layout
+	//////////////////////////////////////////////////////////////////////////
+	if (m_features.local_memory_decode)
+	{
+		dslb.AddBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT);
+		if ((m_local_memory_buffer_ds_layout = dslb.Create(dev)) == VK_NULL_HANDLE)
+			return false;
+		dslb.AddBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, VK_SHADER_STAGE_COMPUTE_BIT);
+		if ((m_local_memory_image_ds_layout = dslb.Create(dev)) == VK_NULL_HANDLE)
+			return false;
+
+		plb.AddPushConstants(VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(LocalMemoryDecodeConstantBuffer));
+		plb.AddDescriptorSet(m_local_memory_buffer_ds_layout);
+		plb.AddDescriptorSet(m_local_memory_image_ds_layout);
+		if ((m_local_memory_pipeline_layout = plb.Create(dev)) == VK_NULL_HANDLE)
+			return false;
+	}
+
 	return true;
 }
 
@@ -2875,6 +3047,27 @@ bool GSDeviceVK::CompileMergePipelines()
 	return true;
 }
 
+bool GSDeviceVK::CompileLocalMemoryDecodePipeline()
+{
+	VkDevice m_device = vk_init_info.device;
+
+	std::stringstream ss;
+	AddShaderHeader(ss);
+	ss << "#define CLUT_OFFSET " << LOCAL_MEMORY_CLUT_OFFSET << "u\n";
+	ss << decode_glsl_shader_raw;
+
+	VkShaderModule cs = g_vulkan_shader_cache->GetComputeShader(ss.str());
+	if (cs == VK_NULL_HANDLE)
+		return false;
+
+	Vulkan::ComputePipelineBuilder cpb;
+	cpb.SetShader(cs, "main");
+	cpb.SetPipelineLayout(m_local_memory_pipeline_layout);
+	m_local_memory_decode_pipeline = cpb.Create(m_device, g_vulkan_shader_cache->GetPipelineCache(true), false);
+	SafeDestroyShaderModule(m_device, cs);
+	return (m_local_memory_decode_pipeline != VK_NULL_HANDLE);
+}
+
 void GSDeviceVK::DestroyResources()
 {
 	VkDevice m_device = vk_init_info.device;
@@ -2995,6 +3188,26 @@ void GSDeviceVK::DestroyResources()
 		m_expand_index_buffer = VK_NULL_HANDLE;
 		m_expand_index_buffer_allocation = VK_NULL_HANDLE;
 	}
+	if (m_local_memory_buffer != VK_NULL_HANDLE)
+	{
+		vmaDestroyBuffer(GetAllocator(), m_local_memory_buffer, m_local_memory_buffer_allocation);
+		m_local_memory_buffer = VK_NULL_HANDLE;
+		m_local_memory_buffer_allocation = VK_NULL_HANDLE;
+	}
+	if (m_local_memory_decode_pipeline != VK_NULL_HANDLE)
+	{
+		vkDestroyPipeline(m_device, m_local_memory_decode_pipeline, nullptr);
+		m_local_memory_decode_pipeline = VK_NULL_HANDLE;
+	}
+	if (m_local_memory_descriptor_set != VK_NULL_HANDLE)
+	{
+		FreeGlobalDescriptorSet(m_local_memory_descriptor_set);
+		m_local_memory_descriptor_set = VK_NULL_HANDLE;
+	}
+
+	SafeDestroyPipelineLayout(m_device, m_local_memory_pipeline_layout);
+	SafeDestroyDescriptorSetLayout(m_device, m_local_memory_image_ds_layout);
+	SafeDestroyDescriptorSetLayout(m_device, m_local_memory_buffer_ds_layout);
 
 	SafeDestroyPipelineLayout(m_device, m_tfx_pipeline_layout);
 	SafeDestroyDescriptorSetLayout(m_device, m_tfx_rt_texture_ds_layout);
@@ -3278,6 +3491,16 @@ bool GSDeviceVK::CreatePersistentDescriptorSets()
 	if (m_features.vs_expand)
 		dsub.AddBufferDescriptorWrite(m_tfx_ubo_descriptor_set, 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
 			m_vertex_stream_buffer.GetBuffer(), 0, VERTEX_BUFFER_SIZE);
+
+	if (m_features.local_memory_decode)
+	{
+		m_local_memory_descriptor_set = AllocatePersistentDescriptorSet(m_local_memory_buffer_ds_layout);
+		if (m_local_memory_descriptor_set == VK_NULL_HANDLE)
+			return false;
+		dsub.AddBufferDescriptorWrite(m_local_memory_descriptor_set, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+			m_local_memory_buffer, 0, LOCAL_MEMORY_BUFFER_SIZE);
+	}
+
 	dsub.Update(vk_init_info.device);
 	return true;
 }
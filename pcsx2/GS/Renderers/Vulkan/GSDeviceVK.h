@@ -339,6 +339,14 @@ private:
 	VkBuffer m_expand_index_buffer = VK_NULL_HANDLE;
 	VmaAllocation m_expand_index_buffer_allocation = VK_NULL_HANDLE;
 
+	VkDescriptorSetLayout m_local_memory_buffer_ds_layout = VK_NULL_HANDLE;
+	VkDescriptorSetLayout m_local_memory_image_ds_layout = VK_NULL_HANDLE;
+	VkPipelineLayout m_local_memory_pipeline_layout = VK_NULL_HANDLE;
+	VkPipeline m_local_memory_decode_pipeline = VK_NULL_HANDLE;
+	VkBuffer m_local_memory_buffer = VK_NULL_HANDLE;
+	VmaAllocation m_local_memory_buffer_allocation = VK_NULL_HANDLE;
+	VkDescriptorSet m_local_memory_descriptor_set = VK_NULL_HANDLE;
+
 	VkSampler m_point_sampler = VK_NULL_HANDLE;
 	VkSampler m_linear_sampler = VK_NULL_HANDLE;
 
@@ -399,6 +407,7 @@ private:
 	bool CompileConvertPipelines();
 	bool CompileInterlacePipelines();
 	bool CompileMergePipelines();
+	bool CompileLocalMemoryDecodePipeline();
 
 	void DestroyResources();
 
@@ -455,6 +464,8 @@ public:
 	void UpdateCLUTTexture(GSTexture* sTex, float sScale, u32 offsetX, u32 offsetY, GSTexture* dTex, u32 dOffset, u32 dSize) override;
 	void ConvertToIndexedTexture(GSTexture* sTex, float sScale, u32 offsetX, u32 offsetY, u32 SBW, u32 SPSM, GSTexture* dTex, u32 DBW, u32 DPSM) override;
 	void FilteredDownsampleTexture(GSTexture* sTex, GSTexture* dTex, u32 downsample_factor, const GSVector2i& clamp_min, const GSVector4& dRect) override;
+	bool UpdateLocalMemoryPages(const u8* vm, const u32* pages, u32 num_pages) override;
+	bool DecodeLocalMemory(GSTexture* dTex, int level, const LocalMemoryDecodeConstantBuffer& cb, const u32* clut) override;
 
 	void SetupDATE(GSTexture* rt, GSTexture* ds, SetDATM datm, const GSVector4i& bbox);
 	GSTextureVK* SetupPrimitiveTrackingDATE(GSHWDrawConfig& config);
@@ -90,6 +90,10 @@ std::unique_ptr<GSTextureVK> GSTextureVK::Create(Type type, Format format, int w
 		{
 			ici.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
 
+			// Sources can be decoded from local memory by a compute shader.
+			if (format == Format::Color && GSDeviceVK::GetInstance()->Features().local_memory_decode)
+				ici.usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+
 			if (format == Format::UNorm8)
 			{
 				// for r8 textures, swizzle it across all 4 components. the shaders depend on it being in alpha.. why?
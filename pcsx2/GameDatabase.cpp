@@ -13,8 +13,11 @@
  *  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <fstream>
+#include <mutex>
 #include <optional>
 
 #include <fmt/format.h>
@@ -22,8 +25,15 @@
 #include "ryml_std.hpp"
 #include "ryml.hpp"
 
+#ifndef XXH_versionNumber
+	#define XXH_STATIC_LINKING_ONLY 1
+	#define XXH_INLINE_ALL 1
+	#include <xxhash.h>
+#endif
+
 #include "common/Console.h"
 #include "common/FileSystem.h"
+#include "common/General.h"
 #include "common/Path.h"
 #include "common/StringUtil.h"
 
@@ -42,14 +52,51 @@ namespace GameDatabaseSchema
 namespace GameDatabase
 {
 	static void parseAndInsert(const char *serial, const c4::yml::NodeRef& node);
+	static void setYamlCallbacks();
 	static void initDatabase();
+	static bool openIndex();
+	static const GameDatabaseSchema::GameEntry* findGameInIndex(const std::string& serial);
 } // namespace GameDatabase
 
 static constexpr char GAMEDB_YAML_FILE_NAME[] = "GameIndex.yaml";
+static constexpr char GAMEDB_INDEX_FILE_NAME[] = "GameIndex.bin";
+
+// Binary index over GameIndex.yaml, written by tools/compile_gameindex.py.
+// Entries are sorted by (lower-case) serial and point at the byte range of that serial's
+// block in the YAML, so a lookup only has to parse the one entry it needs.
+static constexpr char GAMEDB_INDEX_MAGIC[8] = {'G', 'D', 'B', 'I', 'N', 'D', 'E', 'X'};
+static constexpr u32 GAMEDB_INDEX_VERSION = 2;
+
+struct GameIndexHeader
+{
+	char magic[8];
+	u32 version;
+	u32 count;
+	u64 yaml_size;
+	u64 yaml_hash; // XXH64 of the whole YAML, seed 0
+	u32 entries_offset;
+	u32 strings_offset;
+};
+static_assert(sizeof(GameIndexHeader) == 40);
+
+struct GameIndexEntry
+{
+	u32 serial_offset;
+	u32 serial_length;
+	u32 yaml_offset;
+	u32 yaml_length;
+};
+static_assert(sizeof(GameIndexEntry) == 16);
 
 static std::unordered_map<std::string, GameDatabaseSchema::GameEntry> s_game_db;
 static std::once_flag s_load_once_flag;
 
+static std::mutex s_game_db_mutex;
+static const u8* s_index_data = nullptr;
+static size_t s_index_size = 0;
+static const char* s_yaml_data = nullptr;
+static size_t s_yaml_size = 0;
+
 std::string GameDatabaseSchema::GameEntry::memcardFiltersAsString() const
 {
 	return fmt::to_string(fmt::join(memcardFilters, "/"));
@@ -865,7 +912,7 @@ u32 GameDatabaseSchema::GameEntry::applyGSHardwareFixes(Pcsx2Config::GSOptions&
 	return num_applied_fixes;
 }
 
-void GameDatabase::initDatabase()
+void GameDatabase::setYamlCallbacks()
 {
 	ryml::Callbacks rymlCallbacks = ryml::get_callbacks();
 	rymlCallbacks.m_error = [](const char* msg, size_t msg_len, ryml::Location loc, void*) {
@@ -877,6 +924,11 @@ void GameDatabase::initDatabase()
 		Console.Error("[YAML] Internal Parsing error: {%s}",
 			msg);
 	});
+}
+
+void GameDatabase::initDatabase()
+{
+	setYamlCallbacks();
 	auto buf = Host::ReadResourceFileToString(GAMEDB_YAML_FILE_NAME);
 	if (!buf.has_value())
 	{
@@ -907,10 +959,115 @@ void GameDatabase::initDatabase()
 	ryml::reset_callbacks();
 }
 
+bool GameDatabase::openIndex()
+{
+	const std::string index_path(Path::Combine(EmuFolders::Resources, GAMEDB_INDEX_FILE_NAME));
+	const std::string yaml_path(Path::Combine(EmuFolders::Resources, GAMEDB_YAML_FILE_NAME));
+
+	size_t index_size = 0;
+	u8* index_data = static_cast<u8*>(HostSys::MapFileReadOnly(index_path.c_str(), &index_size));
+	if (!index_data)
+		return false;
+
+	size_t yaml_size = 0;
+	char* yaml_data = static_cast<char*>(HostSys::MapFileReadOnly(yaml_path.c_str(), &yaml_size));
+	if (!yaml_data)
+	{
+		HostSys::UnmapFile(index_data, index_size);
+		return false;
+	}
+
+	GameIndexHeader header;
+	bool valid = (index_size >= sizeof(header));
+	if (valid)
+	{
+		std::memcpy(&header, index_data, sizeof(header));
+		valid = (std::memcmp(header.magic, GAMEDB_INDEX_MAGIC, sizeof(header.magic)) == 0 &&
+				 header.version == GAMEDB_INDEX_VERSION &&
+				 header.yaml_size == yaml_size &&
+				 header.entries_offset <= index_size &&
+				 (index_size - header.entries_offset) / sizeof(GameIndexEntry) >= header.count &&
+				 header.strings_offset <= index_size);
+	}
+
+	// Edits can keep the size the same (a flipped fix, a changed digit), so check the contents too.
+	// Hashing the YAML is still far cheaper than parsing all of it.
+	if (valid)
+		valid = (XXH64(yaml_data, yaml_size, 0) == header.yaml_hash);
+
+	// A stale index (the YAML was edited without regenerating it) is ignored rather than trusted.
+	if (!valid)
+	{
+		Console.Warning("[GameDB] Ignoring out of date or invalid %s.", GAMEDB_INDEX_FILE_NAME);
+		HostSys::UnmapFile(yaml_data, yaml_size);
+		HostSys::UnmapFile(index_data, index_size);
+		return false;
+	}
+
+	s_index_data = index_data;
+	s_index_size = index_size;
+	s_yaml_data = yaml_data;
+	s_yaml_size = yaml_size;
+	return true;
+}
+
+const GameDatabaseSchema::GameEntry* GameDatabase::findGameInIndex(const std::string& serial)
+{
+	std::unique_lock lock(s_game_db_mutex);
+
+	auto iter = s_game_db.find(serial);
+	if (iter != s_game_db.end())
+		return &iter->second;
+
+	GameIndexHeader header;
+	std::memcpy(&header, s_index_data, sizeof(header));
+	const GameIndexEntry* entries = reinterpret_cast<const GameIndexEntry*>(s_index_data + header.entries_offset);
+	const char* strings = reinterpret_cast<const char*>(s_index_data + header.strings_offset);
+	const size_t strings_size = s_index_size - header.strings_offset;
+
+	const auto entry_serial = [strings, strings_size](const GameIndexEntry& entry) {
+		if (entry.serial_offset > strings_size || entry.serial_length > strings_size - entry.serial_offset)
+			return std::string_view();
+		return std::string_view(strings + entry.serial_offset, entry.serial_length);
+	};
+
+	const GameIndexEntry* end = entries + header.count;
+	const GameIndexEntry* found = std::lower_bound(entries, end, serial,
+		[&entry_serial](const GameIndexEntry& entry, const std::string& key) { return entry_serial(entry) < key; });
+	if (found == end || entry_serial(*found) != serial ||
+		found->yaml_offset > s_yaml_size || found->yaml_length > s_yaml_size - found->yaml_offset)
+	{
+		return nullptr;
+	}
+
+	setYamlCallbacks();
+
+	ryml::Tree tree = ryml::parse_in_arena(c4::csubstr(s_yaml_data + found->yaml_offset, found->yaml_length));
+	ryml::NodeRef root = tree.rootref();
+	if (root.is_map() && root.num_children() > 0)
+	{
+		const ryml::NodeRef n = root.first_child();
+		if (n.is_map() && StringUtil::toLower(std::string(n.key().str, n.key().len)) == serial)
+			parseAndInsert(serial.c_str(), n);
+	}
+
+	ryml::reset_callbacks();
+
+	iter = s_game_db.find(serial);
+	return (iter != s_game_db.end()) ? &iter->second : nullptr;
+}
+
 void GameDatabase::ensureLoaded()
 {
 	std::call_once(s_load_once_flag, []() {
 		Console.WriteLn("[GameDB] Has not been initialized yet, initializing...");
+		if (openIndex())
+		{
+			Console.WriteLn("[GameDB] Using precompiled index, %u games on record",
+				reinterpret_cast<const GameIndexHeader*>(s_index_data)->count);
+			return;
+		}
+
 		initDatabase();
 		Console.WriteLn("[GameDB] %zu games on record", s_game_db.size());
 	});
@@ -920,6 +1077,9 @@ const GameDatabaseSchema::GameEntry* GameDatabase::findGame(const std::string_vi
 {
 	GameDatabase::ensureLoaded();
 
+	if (s_index_data)
+		return findGameInIndex(StringUtil::toLower(serial));
+
 	auto iter = s_game_db.find(StringUtil::toLower(serial));
 	return (iter != s_game_db.end()) ? &iter->second : nullptr;
 }
@@ -31,6 +31,7 @@ alignas(16) decoder_t decoder;
 IPUStatus IPUCoreStatus;
 
 static void (*IPUWorker)(void);
+static void (*IPUFlush)(void);
 
 // Color conversion stuff, the memory layout is a total hack
 // convert_data_buffer is a pointer to the internal rgb struct (the first param in convert_init_t)
@@ -101,6 +102,8 @@ __fi void IPUProcessInterrupt(void)
 void ipuReset(void)
 {
 	IPUWorker = MULTI_ISA_SELECT(IPUWorker);
+	IPUFlush = MULTI_ISA_SELECT(IPUFlush);
+	IPUFlush();
 	memset(&ipuRegs, 0, sizeof(ipuRegs));
 	memset(&g_BP, 0, sizeof(g_BP));
 	memset(&decoder, 0, sizeof(decoder));
@@ -121,6 +124,8 @@ bool SaveStateBase::ipuFreeze(void)
 	if (!(FreezeTag("IPU")))
 		return false;
 
+	IPUFlush();
+
 	Freeze(ipu_fifo);
 
 	Freeze(g_BP);
@@ -201,6 +206,7 @@ __fi u64 ipuRead64(u32 mem)
 
 void ipuSoftReset(void)
 {
+	IPUFlush();
 	ipu_fifo.clear();
 	memset(&g_BP, 0, sizeof(g_BP));
 
@@ -325,6 +331,7 @@ static void ipuSETTH(u32 val)
 // The actual decoding will be handled by IPUworker.
 __fi void IPUCMD_WRITE(u32 val)
 {
+	IPUFlush();
 	ipuRegs.ctrl.ECD = 0;
 	ipuRegs.ctrl.SCD = 0;
 	ipu_cmd.clear();
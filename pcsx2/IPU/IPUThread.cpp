@@ -0,0 +1,69 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "IPU/IPUThread.h"
+
+#include "common/Threading.h"
+
+#include <atomic>
+
+static Threading::Thread s_thread;
+static Threading::WorkSema s_sema;
+static std::atomic<void (*)()> s_job{nullptr};
+static std::atomic<bool> s_exit{false};
+
+static void ThreadProc()
+{
+	for (;;)
+	{
+		s_sema.WaitForWork();
+		if (s_exit.load(std::memory_order_acquire))
+			break;
+
+		if (void (*job)() = s_job.exchange(nullptr, std::memory_order_acq_rel))
+			job();
+	}
+}
+
+void IPUThread::Submit(void (*func)())
+{
+	if (!s_thread.Joinable())
+		s_thread.Start(ThreadProc);
+	else
+		s_sema.WaitForEmpty();
+
+	s_job.store(func, std::memory_order_release);
+	s_sema.NotifyOfWork();
+}
+
+void IPUThread::Wait()
+{
+	if (s_thread.Joinable())
+		s_sema.WaitForEmpty();
+}
+
+void IPUThread::Shutdown()
+{
+	if (!s_thread.Joinable())
+		return;
+
+	s_sema.WaitForEmpty();
+	s_exit.store(true, std::memory_order_release);
+	s_sema.NotifyOfWork();
+	s_thread.Join();
+
+	s_exit.store(false, std::memory_order_relaxed);
+	s_sema.Reset();
+}
@@ -0,0 +1,33 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Worker thread for the IPU (EmuConfig.Speedhacks.ipuThread). IDEC hands each
+// macroblock's IDCTs and colour conversion to it once the bitstream for the
+// macroblock has been parsed, and only waits for the result when the output
+// FIFO needs the data, so the conversion overlaps with EE/GS work.
+// Holds a single job; all calls are made from the EE thread.
+namespace IPUThread
+{
+	/// Waits for the previous job, then runs func on the worker (starting it if needed).
+	void Submit(void (*func)());
+
+	/// Blocks until the last submitted job has finished. Cheap when idle.
+	void Wait();
+
+	/// Finishes any job and stops the worker thread.
+	void Shutdown();
+} // namespace IPUThread
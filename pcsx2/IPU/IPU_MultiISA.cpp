@@ -30,6 +30,9 @@
 #include "IPU/IPUdma.h"
 #include "IPU/yuv2rgb.h"
 #include "IPU/IPU_MultiISA.h"
+#include "IPU/IPUThread.h"
+
+#include "Config.h"
 
 // the IPU is fixed to 16 byte strides (128-bit / QWC resolution):
 static const uint decoder_stride = 16;
@@ -207,6 +210,169 @@ __ri static u8 getBits8(u8 *address)
  * column inputs are 16-bit values.
  */
 
+#if _M_SSE >= 0x401
+
+// Vectorised IDCT: both passes run the exact integer butterflies of the scalar fallback
+// below in 32-bit lanes, eight rows (or columns) at a time, so the output is bit-identical.
+// The row pass is done on a transposed block so that every lane holds one row.
+
+#if _M_SSE >= 0x501
+typedef __m256i idct_vec;
+
+__fi static idct_vec idct_widen(__m128i v) { return _mm256_cvtepi16_epi32(v); }
+__fi static idct_vec idct_set1(int v) { return _mm256_set1_epi32(v); }
+__fi static idct_vec idct_add(idct_vec a, idct_vec b) { return _mm256_add_epi32(a, b); }
+__fi static idct_vec idct_sub(idct_vec a, idct_vec b) { return _mm256_sub_epi32(a, b); }
+__fi static idct_vec idct_mul(idct_vec a, idct_vec b) { return _mm256_mullo_epi32(a, b); }
+template <int shift> __fi static idct_vec idct_sra(idct_vec a) { return _mm256_srai_epi32(a, shift); }
+template <int shift> __fi static idct_vec idct_sll(idct_vec a) { return _mm256_slli_epi32(a, shift); }
+
+// Truncates to s16 like the scalar stores do (wraps instead of saturating).
+__fi static __m128i idct_narrow(idct_vec v)
+{
+	v = _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16);
+	v = _mm256_permute4x64_epi64(_mm256_packs_epi32(v, v), 0x08);
+	return _mm256_castsi256_si128(v);
+}
+#else
+struct idct_vec
+{
+	__m128i lo, hi;
+};
+
+__fi static idct_vec idct_widen(__m128i v) { return {_mm_cvtepi16_epi32(v), _mm_cvtepi16_epi32(_mm_unpackhi_epi64(v, v))}; }
+__fi static idct_vec idct_set1(int v) { return {_mm_set1_epi32(v), _mm_set1_epi32(v)}; }
+__fi static idct_vec idct_add(idct_vec a, idct_vec b) { return {_mm_add_epi32(a.lo, b.lo), _mm_add_epi32(a.hi, b.hi)}; }
+__fi static idct_vec idct_sub(idct_vec a, idct_vec b) { return {_mm_sub_epi32(a.lo, b.lo), _mm_sub_epi32(a.hi, b.hi)}; }
+__fi static idct_vec idct_mul(idct_vec a, idct_vec b) { return {_mm_mullo_epi32(a.lo, b.lo), _mm_mullo_epi32(a.hi, b.hi)}; }
+template <int shift> __fi static idct_vec idct_sra(idct_vec a) { return {_mm_srai_epi32(a.lo, shift), _mm_srai_epi32(a.hi, shift)}; }
+template <int shift> __fi static idct_vec idct_sll(idct_vec a) { return {_mm_slli_epi32(a.lo, shift), _mm_slli_epi32(a.hi, shift)}; }
+
+// Truncates to s16 like the scalar stores do (wraps instead of saturating).
+__fi static __m128i idct_narrow(idct_vec v)
+{
+	const __m128i lo = _mm_srai_epi32(_mm_slli_epi32(v.lo, 16), 16);
+	const __m128i hi = _mm_srai_epi32(_mm_slli_epi32(v.hi, 16), 16);
+	return _mm_packs_epi32(lo, hi);
+}
+#endif
+
+__fi static void IDCT_BUTTERFLY(idct_vec& t0, idct_vec& t1, int w0, int w1, idct_vec d0, idct_vec d1)
+{
+	const idct_vec tmp = idct_mul(idct_set1(w0), idct_add(d0, d1));
+	t0 = idct_add(tmp, idct_mul(idct_set1(w1 - w0), d1));
+	t1 = idct_sub(tmp, idct_mul(idct_set1(w1 + w0), d0));
+}
+
+__fi static void IDCT_Transpose(__m128i r[8])
+{
+	const __m128i a0 = _mm_unpacklo_epi16(r[0], r[1]);
+	const __m128i a1 = _mm_unpackhi_epi16(r[0], r[1]);
+	const __m128i a2 = _mm_unpacklo_epi16(r[2], r[3]);
+	const __m128i a3 = _mm_unpackhi_epi16(r[2], r[3]);
+	const __m128i a4 = _mm_unpacklo_epi16(r[4], r[5]);
+	const __m128i a5 = _mm_unpackhi_epi16(r[4], r[5]);
+	const __m128i a6 = _mm_unpacklo_epi16(r[6], r[7]);
+	const __m128i a7 = _mm_unpackhi_epi16(r[6], r[7]);
+
+	const __m128i b0 = _mm_unpacklo_epi32(a0, a2);
+	const __m128i b1 = _mm_unpackhi_epi32(a0, a2);
+	const __m128i b2 = _mm_unpacklo_epi32(a1, a3);
+	const __m128i b3 = _mm_unpackhi_epi32(a1, a3);
+	const __m128i b4 = _mm_unpacklo_epi32(a4, a6);
+	const __m128i b5 = _mm_unpackhi_epi32(a4, a6);
+	const __m128i b6 = _mm_unpacklo_epi32(a5, a7);
+	const __m128i b7 = _mm_unpackhi_epi32(a5, a7);
+
+	r[0] = _mm_unpacklo_epi64(b0, b4);
+	r[1] = _mm_unpackhi_epi64(b0, b4);
+	r[2] = _mm_unpacklo_epi64(b1, b5);
+	r[3] = _mm_unpackhi_epi64(b1, b5);
+	r[4] = _mm_unpacklo_epi64(b2, b6);
+	r[5] = _mm_unpackhi_epi64(b2, b6);
+	r[6] = _mm_unpacklo_epi64(b3, b7);
+	r[7] = _mm_unpackhi_epi64(b3, b7);
+}
+
+// One 1-D pass over eight lanes; the column pass differs from the row pass only in its
+// rounding constant and where the 181/256 scaling drops its low bits.
+template <bool column>
+__fi static void IDCT_Pass(__m128i r[8])
+{
+	idct_vec a0, a1, a2, a3;
+	{
+		const idct_vec d0 = idct_add(idct_sll<11>(idct_widen(r[0])), idct_set1(column ? 65536 : 128));
+		const idct_vec d1 = idct_widen(r[1]);
+		const idct_vec d2 = idct_sll<11>(idct_widen(r[2]));
+		const idct_vec d3 = idct_widen(r[3]);
+		const idct_vec t0 = idct_add(d0, d2);
+		const idct_vec t1 = idct_sub(d0, d2);
+		idct_vec t2, t3;
+		IDCT_BUTTERFLY(t2, t3, W6, W2, d3, d1);
+		a0 = idct_add(t0, t2);
+		a1 = idct_add(t1, t3);
+		a2 = idct_sub(t1, t3);
+		a3 = idct_sub(t0, t2);
+	}
+
+	idct_vec b0, b1, b2, b3;
+	{
+		const idct_vec d0 = idct_widen(r[4]);
+		const idct_vec d1 = idct_widen(r[5]);
+		const idct_vec d2 = idct_widen(r[6]);
+		const idct_vec d3 = idct_widen(r[7]);
+		idct_vec t0, t1, t2, t3;
+		IDCT_BUTTERFLY(t0, t1, W7, W1, d3, d0);
+		IDCT_BUTTERFLY(t2, t3, W3, W5, d1, d2);
+		b0 = idct_add(t0, t2);
+		b3 = idct_add(t1, t3);
+		const idct_vec k181 = idct_set1(181);
+		if (column)
+		{
+			t0 = idct_sra<8>(idct_sub(t0, t2));
+			t1 = idct_sra<8>(idct_sub(t1, t3));
+			b1 = idct_mul(idct_add(t0, t1), k181);
+			b2 = idct_mul(idct_sub(t0, t1), k181);
+		}
+		else
+		{
+			t0 = idct_sub(t0, t2);
+			t1 = idct_sub(t1, t3);
+			b1 = idct_sra<8>(idct_mul(idct_add(t0, t1), k181));
+			b2 = idct_sra<8>(idct_mul(idct_sub(t0, t1), k181));
+		}
+	}
+
+	constexpr int shift = column ? 17 : 8;
+	r[0] = idct_narrow(idct_sra<shift>(idct_add(a0, b0)));
+	r[1] = idct_narrow(idct_sra<shift>(idct_add(a1, b1)));
+	r[2] = idct_narrow(idct_sra<shift>(idct_add(a2, b2)));
+	r[3] = idct_narrow(idct_sra<shift>(idct_add(a3, b3)));
+	r[4] = idct_narrow(idct_sra<shift>(idct_sub(a3, b3)));
+	r[5] = idct_narrow(idct_sra<shift>(idct_sub(a2, b2)));
+	r[6] = idct_narrow(idct_sra<shift>(idct_sub(a1, b1)));
+	r[7] = idct_narrow(idct_sra<shift>(idct_sub(a0, b0)));
+}
+
+// The scalar row pass has a DC-only shortcut; it yields the same values as the full
+// butterfly ((d0 << 11) + 128) >> 8 == d0 << 3), so the vector version does not need it.
+__ri static void IDCT_Block(s16* block)
+{
+	__m128i r[8];
+	for (int i = 0; i < 8; i++)
+		r[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(block + 8 * i));
+
+	IDCT_Transpose(r);
+	IDCT_Pass<false>(r);
+	IDCT_Transpose(r);
+	IDCT_Pass<true>(r);
+
+	for (int i = 0; i < 8; i++)
+		_mm_store_si128(reinterpret_cast<__m128i*>(block + 8 * i), r[i]);
+}
+
+#else
+
 __fi static void BUTTERFLY(int& t0, int& t1, int w0, int w1, int d0, int d1)
 {
 	int tmp = w0 * (d0 + d1);
@@ -323,10 +489,29 @@ __ri static void IDCT_Block(s16* block)
 	}
 }
 
+#endif
+
 __ri static void IDCT_Copy(s16* block, u8* dest, const int stride)
 {
 	IDCT_Block(block);
 
+#if _M_SSE >= 0x401
+	// packus clamps to 0..255 exactly like the clip table does over its range.
+	const __m128i zero = _mm_setzero_si128();
+	for (int i = 0; i < 8; i += 2)
+	{
+		const __m128i r0 = _mm_load_si128(reinterpret_cast<const __m128i*>(block));
+		const __m128i r1 = _mm_load_si128(reinterpret_cast<const __m128i*>(block + 8));
+		const __m128i px = _mm_packus_epi16(r0, r1);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(dest), px);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(dest + stride), _mm_unpackhi_epi64(px, px));
+		_mm_store_si128(reinterpret_cast<__m128i*>(block), zero);
+		_mm_store_si128(reinterpret_cast<__m128i*>(block + 8), zero);
+
+		dest += stride * 2;
+		block += 16;
+	}
+#else
 	for (int i = 0; i < 8; i++)
 	{
 		dest[0] = (g_idct_clip_lut.data() + 384)[block[0]];
@@ -343,6 +528,7 @@ __ri static void IDCT_Copy(s16* block, u8* dest, const int stride)
 		dest += stride;
 		block += 8;
 	}
+#endif
 }
 
 
@@ -839,6 +1025,34 @@ __ri static bool get_non_intra_block(int * last)
 	return true;
 }
 
+// Intra blocks of the current IDEC macroblock whose IDCT has been left to the IPU thread.
+static struct
+{
+	alignas(16) s16 block[6][64];
+	u8* dest[6];
+	int stride[6];
+	int count;
+	int sgn, dte, ofm;
+} s_idec_deferred;
+
+static void IDEC_FlushBlocks()
+{
+	for (int i = 0; i < s_idec_deferred.count; i++)
+		IDCT_Copy(s_idec_deferred.block[i], s_idec_deferred.dest[i], s_idec_deferred.stride[i]);
+	s_idec_deferred.count = 0;
+}
+
+// Everything IDEC does to a macroblock once its bitstream has been parsed.
+// Runs on the IPU thread when EmuConfig.Speedhacks.ipuThread is set.
+static void IDEC_ConvertMacroblock()
+{
+	IDEC_FlushBlocks();
+
+	ipu_csc(decoder.mb8, decoder.rgb32, s_idec_deferred.sgn);
+	if (s_idec_deferred.ofm != 0)
+		ipu_dither(decoder.rgb32, decoder.rgb16, s_idec_deferred.dte);
+}
+
 __ri static bool slice_intra_DCT(const int cc, u8 * const dest, const int stride, const bool skip)
 {
 	if (!skip || ipu_cmd.pos[3])
@@ -862,7 +1076,18 @@ __ri static bool slice_intra_DCT(const int cc, u8 * const dest, const int stride
 	if (!get_intra_block())
 		return false;
 
-	IDCT_Copy(decoder.DCTblock, dest, stride);
+	if (ipu_cmd.CMD == SCE_IPU_IDEC && EmuConfig.Speedhacks.ipuThread)
+	{
+		const int i = s_idec_deferred.count++;
+		memcpy(s_idec_deferred.block[i], decoder.DCTblock, sizeof(decoder.DCTblock));
+		memset(decoder.DCTblock, 0, sizeof(decoder.DCTblock));
+		s_idec_deferred.dest[i] = dest;
+		s_idec_deferred.stride[i] = stride;
+	}
+	else
+	{
+		IDCT_Copy(decoder.DCTblock, dest, stride);
+	}
 
 	return true;
 }
@@ -942,6 +1167,7 @@ __ri static bool mpeg2sliceIDEC(void)
 						decoder.coded_block_pattern = 0x3F;//all 6 blocks
 						memset(&mb8, 0, sizeof(mb8));
 						memset(&rgb32, 0, sizeof(rgb32));
+						s_idec_deferred.count = 0;
 						/* fall-through */
 
 					case 1:
@@ -1013,15 +1239,18 @@ __ri static bool mpeg2sliceIDEC(void)
 						}
 
 						// Send The MacroBlock via DmaIpuFrom
-						ipu_csc(mb8, rgb32, decoder.sgn);
+						s_idec_deferred.sgn = decoder.sgn;
+						s_idec_deferred.dte = decoder.dte;
+						s_idec_deferred.ofm = decoder.ofm;
+						if (EmuConfig.Speedhacks.ipuThread)
+							IPUThread::Submit(IDEC_ConvertMacroblock);
+						else
+							IDEC_ConvertMacroblock();
 
 						if (decoder.ofm == 0)
 							decoder.SetOutputTo(rgb32);
 						else
-						{
-							ipu_dither(rgb32, rgb16, decoder.dte);
 							decoder.SetOutputTo(rgb16);
-						}
 						ipu_cmd.pos[1] = 2;
 
 						/* fallthrough */
@@ -1038,6 +1267,9 @@ __ri static bool mpeg2sliceIDEC(void)
 								return false;
 							}
 
+							// The macroblock may still be converting on the IPU thread.
+							IPUThread::Wait();
+
 							uint read = ipu_fifo.out.write((u32*)decoder.GetIpuDataPtr(), decoder.ipu0_data);
 							decoder.AdvanceIpuDataBy(read);
 
@@ -1747,14 +1979,46 @@ __ri static bool ipuPACK(tIPU_CMD_CSC csc)
 
 __fi static void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn)
 {
-	int i;
-	u8* p = (u8*)&rgb32;
-
 	yuv2rgb();
 
+#if _M_SSE >= 0x200
+	const bool thresh = (g_ipu_thresh[0] > 0) || (g_ipu_thresh[1] > 0);
+	if (!thresh && !sgn)
+		return;
+
+	// A pixel is below a threshold when its largest component is. The thresholds are 9 bits,
+	// so compare as 32-bit lanes; a zero threshold never matches.
+	const __m128i thresh0 = _mm_set1_epi32(g_ipu_thresh[0]);
+	const __m128i thresh1 = _mm_set1_epi32(g_ipu_thresh[1]);
+	const __m128i byte_mask = _mm_set1_epi32(0xFF);
+	const __m128i rgb_mask = _mm_set1_epi32(0x00FFFFFF);
+	const __m128i alpha_40 = _mm_set1_epi32(0x40000000);
+	const __m128i sgn_mask = _mm_set1_epi32(sgn ? 0x808080 : 0);
+
+	__m128i* p = reinterpret_cast<__m128i*>(&rgb32);
+	for (int i = 0; i < 16 * 16 / 4; i++)
+	{
+		__m128i px = _mm_load_si128(p + i);
+
+		if (thresh)
+		{
+			const __m128i max = _mm_and_si128(_mm_max_epu8(_mm_max_epu8(px, _mm_srli_epi32(px, 8)), _mm_srli_epi32(px, 16)), byte_mask);
+			const __m128i below0 = _mm_cmpgt_epi32(thresh0, max);
+			const __m128i below1 = _mm_cmpgt_epi32(thresh1, max);
+
+			const __m128i translucent = _mm_or_si128(_mm_and_si128(px, rgb_mask), alpha_40);
+			px = _mm_or_si128(_mm_andnot_si128(below1, px), _mm_and_si128(below1, translucent));
+			px = _mm_andnot_si128(below0, px);
+		}
+
+		_mm_store_si128(p + i, _mm_xor_si128(px, sgn_mask));
+	}
+#else
+	u8* p = (u8*)&rgb32;
+
 	if (g_ipu_thresh[0] > 0)
 	{
-		for (i = 0; i < 16*16; i++, p += 4)
+		for (int i = 0; i < 16*16; i++, p += 4)
 		{
 			if ((p[0] < g_ipu_thresh[0]) && (p[1] < g_ipu_thresh[0]) && (p[2] < g_ipu_thresh[0]))
 				*(u32*)p = 0;
@@ -1764,7 +2028,7 @@ __fi static void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn)
 	}
 	else if (g_ipu_thresh[1] > 0)
 	{
-		for (i = 0; i < 16*16; i++, p += 4)
+		for (int i = 0; i < 16*16; i++, p += 4)
 		{
 			if ((p[0] < g_ipu_thresh[1]) && (p[1] < g_ipu_thresh[1]) && (p[2] < g_ipu_thresh[1]))
 				p[3] = 0x40;
@@ -1772,13 +2036,53 @@ __fi static void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn)
 	}
 	if (sgn)
 	{
-		for (i = 0; i < 16*16; i++, p += 4)
+		p = (u8*)&rgb32;
+		for (int i = 0; i < 16*16; i++, p += 4)
 			*(u32*)p ^= 0x808080;
 	}
+#endif
 }
 
 __fi static void ipu_vq(macroblock_rgb16& rgb16, u8* indx4)
 {
+#if _M_SSE >= 0x200
+	// Eight pixels per register; the largest distance (3 * 31^2) fits in 16 bits. Only a
+	// strictly closer entry replaces the current one, so ties keep the lowest index.
+	const __m128i mask5 = _mm_set1_epi16(0x1F);
+	const __m128i low_byte = _mm_set1_epi16(0xFF);
+
+	for (int i = 0; i < 16; ++i)
+	{
+		__m128i index[2];
+		for (int h = 0; h < 2; ++h)
+		{
+			const __m128i px = _mm_load_si128(reinterpret_cast<const __m128i*>(&rgb16.c[i][h * 8]));
+			const __m128i r = _mm_and_si128(px, mask5);
+			const __m128i g = _mm_and_si128(_mm_srli_epi16(px, 5), mask5);
+			const __m128i b = _mm_and_si128(_mm_srli_epi16(px, 10), mask5);
+
+			__m128i best = _mm_set1_epi16(0x7FFF);
+			__m128i best_index = _mm_setzero_si128();
+			for (int k = 0; k < 16; ++k)
+			{
+				const __m128i dr = _mm_sub_epi16(r, _mm_set1_epi16(g_ipu_vqclut[k].r));
+				const __m128i dg = _mm_sub_epi16(g, _mm_set1_epi16(g_ipu_vqclut[k].g));
+				const __m128i db = _mm_sub_epi16(b, _mm_set1_epi16(g_ipu_vqclut[k].b));
+				const __m128i distance = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(dr, dr), _mm_mullo_epi16(dg, dg)), _mm_mullo_epi16(db, db));
+
+				const __m128i closer = _mm_cmpgt_epi16(best, distance);
+				best = _mm_min_epi16(best, distance);
+				best_index = _mm_or_si128(_mm_andnot_si128(closer, best_index), _mm_and_si128(closer, _mm_set1_epi16(k)));
+			}
+			index[h] = best_index;
+		}
+
+		// Bytes are pixel indices; fold each odd pixel into the high nibble of its even neighbour.
+		const __m128i bytes = _mm_packus_epi16(index[0], index[1]);
+		const __m128i packed = _mm_and_si128(_mm_or_si128(bytes, _mm_srli_epi16(bytes, 4)), low_byte);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(indx4 + i * 8), _mm_packus_epi16(packed, packed));
+	}
+#else
 	const auto closest_index = [&](int i, int j) {
 		u8 index = 0;
 		int min_distance = std::numeric_limits<int>::max();
@@ -1803,6 +2107,15 @@ __fi static void ipu_vq(macroblock_rgb16& rgb16, u8* indx4)
 	for (int i = 0; i < 16; ++i)
 		for (int j = 0; j < 8; ++j)
 			indx4[i * 8 + j] = closest_index(i, 2 * j + 1) << 4 | closest_index(i, 2 * j);
+#endif
+}
+
+// Completes work IDEC has deferred, so decoder state is current for savestates,
+// resets and new commands.
+void IPUFlush(void)
+{
+	IPUThread::Wait();
+	IDEC_FlushBlocks();
 }
 
 __noinline void IPUWorker(void)
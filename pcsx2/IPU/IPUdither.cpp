@@ -24,9 +24,75 @@
 
 MULTI_ISA_UNSHARED_START
 
+#if _M_SSE >= 0x501
+// Converts one row of 16 pixels. The SSE2 path handles pixels 0-7 and 8-15 separately, each
+// as a 0123/4567 register pair; here the low lanes hold the first half and the high lanes the
+// second, so the same in-lane unpacks produce the whole row in one register.
+template <bool dither>
+__fi static void ipu_dither_row(const u8* src, void* dst, const __m256i& dither_add, const __m256i& dither_sub)
+{
+	const __m256i alpha_test = _mm256_set1_epi16(0x40);
+	const __m256i rgba_8_0_7 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+	const __m256i rgba_8_8_15 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32));
+
+	__m256i rgba_8_0123 = _mm256_permute2x128_si256(rgba_8_0_7, rgba_8_8_15, 0x20);
+	__m256i rgba_8_4567 = _mm256_permute2x128_si256(rgba_8_0_7, rgba_8_8_15, 0x31);
+
+	if (dither)
+	{
+		rgba_8_0123 = _mm256_subs_epu8(_mm256_adds_epu8(rgba_8_0123, dither_add), dither_sub);
+		rgba_8_4567 = _mm256_subs_epu8(_mm256_adds_epu8(rgba_8_4567, dither_add), dither_sub);
+	}
+
+	const __m256i rgba_16_0415   = _mm256_unpacklo_epi8(rgba_8_0123, rgba_8_4567);
+	const __m256i rgba_16_2637   = _mm256_unpackhi_epi8(rgba_8_0123, rgba_8_4567);
+	const __m256i rgba_32_0246   = _mm256_unpacklo_epi8(rgba_16_0415, rgba_16_2637);
+	const __m256i rgba_32_1357   = _mm256_unpackhi_epi8(rgba_16_0415, rgba_16_2637);
+	const __m256i rg_64_01234567 = _mm256_unpacklo_epi8(rgba_32_0246, rgba_32_1357);
+	const __m256i ba_64_01234567 = _mm256_unpackhi_epi8(rgba_32_0246, rgba_32_1357);
+
+	const __m256i zero = _mm256_setzero_si256();
+	__m256i r = _mm256_unpacklo_epi8(rg_64_01234567, zero);
+	__m256i g = _mm256_unpackhi_epi8(rg_64_01234567, zero);
+	__m256i b = _mm256_unpacklo_epi8(ba_64_01234567, zero);
+	__m256i a = _mm256_unpackhi_epi8(ba_64_01234567, zero);
+
+	r = _mm256_srli_epi16(r, 3);
+	g = _mm256_slli_epi16(_mm256_srli_epi16(g, 3), 5);
+	b = _mm256_slli_epi16(_mm256_srli_epi16(b, 3), 10);
+	a = _mm256_slli_epi16(_mm256_cmpeq_epi16(a, alpha_test), 15);
+
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_or_si256(_mm256_or_si256(r, g), _mm256_or_si256(b, a)));
+}
+#endif
+
 __ri void ipu_dither(const macroblock_rgb32 &rgb32, macroblock_rgb16 &rgb16, const int dte)
 {
-#if _M_SSE >= 0x200 /* SSE2 codepath */
+#if _M_SSE >= 0x501 /* AVX2 codepath */
+	if (dte)
+	{
+		const __m256i dither_add_matrix[] = {
+			_mm256_broadcastsi128_si256(_mm_setr_epi32(0x00000000, 0x00000000, 0x00000000, 0x00010101)),
+			_mm256_broadcastsi128_si256(_mm_setr_epi32(0x00020202, 0x00000000, 0x00030303, 0x00000000)),
+			_mm256_broadcastsi128_si256(_mm_setr_epi32(0x00000000, 0x00010101, 0x00000000, 0x00000000)),
+			_mm256_broadcastsi128_si256(_mm_setr_epi32(0x00030303, 0x00000000, 0x00020202, 0x00000000)),
+		};
+		const __m256i dither_sub_matrix[] = {
+			_mm256_broadcastsi128_si256(_mm_setr_epi32(0x00040404, 0x00000000, 0x00030303, 0x00000000)),
+			_mm256_broadcastsi128_si256(_mm_setr_epi32(0x00000000, 0x00020202, 0x00000000, 0x00010101)),
+			_mm256_broadcastsi128_si256(_mm_setr_epi32(0x00030303, 0x00000000, 0x00040404, 0x00000000)),
+			_mm256_broadcastsi128_si256(_mm_setr_epi32(0x00000000, 0x00010101, 0x00000000, 0x00020202)),
+		};
+		for (int i = 0; i < 16; ++i)
+			ipu_dither_row<true>(reinterpret_cast<const u8*>(&rgb32.c[i][0]), &rgb16.c[i][0], dither_add_matrix[i & 3], dither_sub_matrix[i & 3]);
+	}
+	else
+	{
+		const __m256i zero = _mm256_setzero_si256();
+		for (int i = 0; i < 16; ++i)
+			ipu_dither_row<false>(reinterpret_cast<const u8*>(&rgb32.c[i][0]), &rgb16.c[i][0], zero, zero);
+	}
+#elif _M_SSE >= 0x200 /* SSE2 codepath */
 	const __m128i alpha_test = _mm_set1_epi16(0x40);
 	if (dte)
 	{
@@ -26,31 +26,15 @@
 #include "Patch.h"
 #include "IopMem.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 #include <file/file_path.h>
 
-enum patch_cpu_type {
-	NO_CPU = 0,
-	CPU_EE,
-	CPU_IOP
-};
-
-enum patch_data_type {
-	NO_TYPE = 0,
-	BYTE_T,
-	SHORT_T,
-	WORD_T,
-	DOUBLE_T,
-	EXTENDED_T,
-	SHORT_LE_T,
-	WORD_LE_T,
-	DOUBLE_LE_T
-};
-
-
 static u32 SkipCount          = 0;
 static u32 IterationCount     = 0;
 static u32 IterationIncrement = 0;
@@ -608,18 +592,20 @@ void _ApplyPatch(IniPatch *p)
 	}
 }
 
-static void _ApplyDynaPatch(const DynamicPatch& patch, u32 address)
+static bool _ApplyDynaPatch(const DynamicPatch& patch, u32 address)
 {
 	for (const auto& pattern : patch.pattern)
 	{
 		if (*static_cast<u32*>(PSM(address + pattern.offset)) != pattern.value)
-			return;
+			return false;
 	}
 
 	Console.WriteLn("Applying Dynamic Patch to address 0x%08X", address);
 	// If everything passes, apply the patch.
 	for (const auto& replacement : patch.replacement)
 		memWrite32(address + replacement.offset, replacement.value);
+
+	return true;
 }
 
 // This is a declaration for PatchMemory.cpp::_ApplyPatch where we're (patch.cpp)
@@ -629,6 +615,28 @@ static void _ApplyDynaPatch(const DynamicPatch& patch, u32 address)
 std::vector<IniPatch> Patch;
 static std::vector<DynamicPatch> DynaPatch;
 
+// Continuous patches, flattened out of Patch so the per-vsync loop doesn't have to filter
+// by place or re-derive sizes and byte swaps. Rebuilt whenever Patch changes.
+struct ContinuousPatch
+{
+	const IniPatch* patch;
+	u64 value; // already byte swapped for the LE types
+	u8 size; // in bytes, 0 when the patch has to go through _ApplyPatch()
+};
+static std::vector<ContinuousPatch> s_continuous_patches;
+static bool s_continuous_patches_dirty = true;
+
+// Dynamic patches keyed by the offset and value of their first pattern word, so the
+// recompiler only checks the patches whose first word actually matches at pc.
+static std::unordered_multimap<u64, size_t> s_dyna_patch_lookup;
+static std::vector<u32> s_dyna_patch_offsets;
+static std::vector<size_t> s_dyna_patch_unkeyed;
+
+static __fi u64 DynaPatchKey(u32 offset, u32 value)
+{
+	return (static_cast<u64>(offset) << 32) | value;
+}
+
 struct PatchTextTable
 {
 	int code;
@@ -729,10 +737,108 @@ int LoadPatchesFromString(const std::string& patches)
 	return static_cast<int>(Patch.size() - before);
 }
 
+void LoadPatch(const IniPatch& patch)
+{
+	Patch.push_back(patch);
+	s_continuous_patches_dirty = true;
+}
+
+int LoadPatchesFromTable(const IniPatch* patches, size_t count)
+{
+	Patch.insert(Patch.end(), patches, patches + count);
+	s_continuous_patches_dirty = true;
+	return static_cast<int>(count);
+}
+
 void ForgetLoadedPatches(void)
 {
 	Patch.clear();
 	DynaPatch.clear();
+	s_continuous_patches.clear();
+	s_continuous_patches_dirty = true;
+	s_dyna_patch_lookup.clear();
+	s_dyna_patch_offsets.clear();
+	s_dyna_patch_unkeyed.clear();
+}
+
+static void CompileContinuousPatches()
+{
+	s_continuous_patches.clear();
+
+	for (const IniPatch& p : Patch)
+	{
+		if (p.placetopatch != PPT_CONTINUOUSLY && p.placetopatch != PPT_COMBINED_0_1)
+			continue;
+
+		ContinuousPatch cp = {&p, p.data, 0};
+		if (p.enabled && p.cpu == CPU_EE)
+		{
+			switch (p.type)
+			{
+				case BYTE_T:      cp.size = 1; break;
+				case SHORT_T:     cp.size = 2; break;
+				case WORD_T:      cp.size = 4; break;
+				case DOUBLE_T:    cp.size = 8; break;
+				case SHORT_LE_T:  cp.size = 2; cp.value = SwapEndian(p.data, 16); break;
+				case WORD_LE_T:   cp.size = 4; cp.value = SwapEndian(p.data, 32); break;
+				case DOUBLE_LE_T: cp.size = 8; cp.value = SwapEndian(p.data, 64); break;
+				default:          break;
+			}
+		}
+
+		s_continuous_patches.push_back(cp);
+	}
+
+	s_continuous_patches_dirty = false;
+}
+
+// Plain EE writes compare against RAM directly and only go through the vtlb when the game
+// has overwritten the patched value. Anything else (extended codes, IOP, I/O mapped pages,
+// or the interpreter's data cache) takes the regular _ApplyPatch() path, in the original order.
+void ApplyContinuousPatches()
+{
+	if (s_continuous_patches_dirty)
+		CompileContinuousPatches();
+
+	const bool direct_reads = (CHECK_EEREC || !CHECK_CACHE);
+
+	for (const ContinuousPatch& cp : s_continuous_patches)
+	{
+		if (cp.size == 0 || !direct_reads)
+		{
+			_ApplyPatch(const_cast<IniPatch*>(cp.patch));
+			continue;
+		}
+
+		const u32 addr = cp.patch->addr;
+		const auto vmv = vtlb_private::vtlbdata.vmap[addr >> vtlb_private::VTLB_PAGE_BITS];
+		if (vmv.isHandler(addr))
+		{
+			_ApplyPatch(const_cast<IniPatch*>(cp.patch));
+			continue;
+		}
+
+		const void* ptr = reinterpret_cast<const void*>(vmv.assumePtr(addr));
+		switch (cp.size)
+		{
+			case 1:
+				if (*static_cast<const u8*>(ptr) != static_cast<u8>(cp.value))
+					memWrite8(addr, static_cast<u8>(cp.value));
+				break;
+			case 2:
+				if (*static_cast<const u16*>(ptr) != static_cast<u16>(cp.value))
+					memWrite16(addr, static_cast<u16>(cp.value));
+				break;
+			case 4:
+				if (*static_cast<const u32*>(ptr) != static_cast<u32>(cp.value))
+					memWrite32(addr, static_cast<u32>(cp.value));
+				break;
+			case 8:
+				if (*static_cast<const u64*>(ptr) != cp.value)
+					memWrite64(addr, cp.value);
+				break;
+		}
+	}
 }
 
 // This routine loads patches from a zip file
@@ -859,6 +965,7 @@ namespace PatchFunc
 
 		iPatch.enabled = 1;
 		Patch.push_back(iPatch);
+		s_continuous_patches_dirty = true;
 
 #undef PATCH_ERROR
 	}
@@ -866,15 +973,53 @@ namespace PatchFunc
 
 void ApplyDynamicPatches(u32 pc)
 {
-	for (const auto& dynpatch : DynaPatch)
+	if (DynaPatch.empty())
+		return;
+
+	std::vector<size_t> candidates(s_dyna_patch_unkeyed);
+	for (const u32 offset : s_dyna_patch_offsets)
+	{
+		const u32* code = static_cast<const u32*>(PSM(pc + offset));
+		if (!code)
+			continue;
+
+		const auto range = s_dyna_patch_lookup.equal_range(DynaPatchKey(offset, *code));
+		for (auto it = range.first; it != range.second; ++it)
+			candidates.push_back(it->second);
+	}
+
+	if (candidates.empty())
+		return;
+
+	std::sort(candidates.begin(), candidates.end());
+	for (size_t i = 0; i < candidates.size(); i++)
 	{
-		_ApplyDynaPatch(dynpatch, pc);
+		if (!_ApplyDynaPatch(DynaPatch[candidates[i]], pc))
+			continue;
+
+		// The replacement may have made later patches match where they didn't before,
+		// so check the rest the slow way to keep the same result as a linear scan.
+		for (size_t j = candidates[i] + 1; j < DynaPatch.size(); j++)
+			_ApplyDynaPatch(DynaPatch[j], pc);
+		break;
 	}
 }
 
 void LoadDynamicPatches(const std::vector<DynamicPatch>& patches)
 {
 	for (const DynamicPatch& it : patches){
+		const size_t index = DynaPatch.size();
 		DynaPatch.push_back(it);
+
+		if (it.pattern.empty())
+		{
+			s_dyna_patch_unkeyed.push_back(index);
+			continue;
+		}
+
+		const DynamicPatchEntry& first = it.pattern.front();
+		s_dyna_patch_lookup.emplace(DynaPatchKey(first.offset, first.value), index);
+		if (std::find(s_dyna_patch_offsets.begin(), s_dyna_patch_offsets.end(), first.offset) == s_dyna_patch_offsets.end())
+			s_dyna_patch_offsets.push_back(first.offset);
 	}
 }
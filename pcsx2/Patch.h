@@ -62,6 +62,24 @@
 #define PPT_COMBINED_0_1 2
 #define _PPT_END_MARKER  3
 
+enum patch_cpu_type {
+	NO_CPU = 0,
+	CPU_EE,
+	CPU_IOP
+};
+
+enum patch_data_type {
+	NO_TYPE = 0,
+	BYTE_T,
+	SHORT_T,
+	WORD_T,
+	DOUBLE_T,
+	EXTENDED_T,
+	SHORT_LE_T,
+	WORD_LE_T,
+	DOUBLE_LE_T
+};
+
 typedef void PATCHTABLEFUNC(const std::string_view& text1, const std::string_view& text2);
 
 struct IniPatch
@@ -103,6 +121,10 @@ extern int  LoadPatchesFromString(const std::string& patches);
 extern int  LoadPatchesFromDir(const std::string& crc, const std::string& folder, const char* friendly_name, bool show_error_when_missing);
 extern int  LoadPatchesFromZip(const std::string& crc, const u8* zip_data, size_t zip_data_size);
 
+// Adds already parsed patch lines, skipping the pnach text parser entirely.
+extern void LoadPatch(const IniPatch& patch);
+extern int  LoadPatchesFromTable(const IniPatch* patches, size_t count);
+
 // Functions for Dynamic EE patching.
 extern void LoadDynamicPatches(const std::vector<DynamicPatch>& patches);
 extern void ApplyDynamicPatches(u32 pc);
@@ -116,4 +138,8 @@ extern void ApplyDynamicPatches(u32 pc);
 // Following ApplyLoadedPatches calls will do nothing until some LoadPatchesFrom* are invoked.
 extern void ForgetLoadedPatches(void);
 
+// Applies the loaded patches with a continuous place value (PPT_CONTINUOUSLY and PPT_COMBINED_0_1),
+// skipping the memory writes for the ones whose value is still in place.
+extern void ApplyContinuousPatches();
+
 extern void _ApplyPatch(IniPatch* p);
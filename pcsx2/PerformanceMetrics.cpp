@@ -25,12 +25,16 @@ static PerformanceMetrics::InternalFPSMethod s_internal_fps_method = Performance
 static u32 s_gs_framebuffer_blits_since_last_update = 0;
 static u32 s_gs_privileged_register_writes_since_last_update = 0;
 
+// software renderer vertex heap
+static PerformanceMetrics::GSHeapStats s_gs_heap_stats = {};
+
 void PerformanceMetrics::Clear()
 {
 	Reset();
 
 	s_internal_fps_method = PerformanceMetrics::InternalFPSMethod::None;
 
+	s_gs_heap_stats = {};
 }
 
 void PerformanceMetrics::Reset()
@@ -70,3 +74,13 @@ PerformanceMetrics::InternalFPSMethod PerformanceMetrics::GetInternalFPSMethod()
 {
 	return s_internal_fps_method;
 }
+
+void PerformanceMetrics::SetGSHeapStats(const GSHeapStats& stats)
+{
+	s_gs_heap_stats = stats;
+}
+
+const PerformanceMetrics::GSHeapStats& PerformanceMetrics::GetGSHeapStats()
+{
+	return s_gs_heap_stats;
+}
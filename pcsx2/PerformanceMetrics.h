@@ -17,6 +17,8 @@
 
 #include <array>
 
+#include "common/Pcsx2Types.h"
+
 namespace PerformanceMetrics
 {
 	enum class InternalFPSMethod
@@ -26,9 +28,21 @@ namespace PerformanceMetrics
 		DISPFBBlit
 	};
 
+	/// Software renderer vertex heap counters, totals since the renderer was created
+	struct GSHeapStats
+	{
+		u64 allocations;
+		u64 bytes_allocated;
+		u32 buffer_grows;
+		u64 buffer_size;
+	};
+
 	void Clear();
 	void Reset();
 	void Update(bool gs_register_write, bool fb_blit);
 
 	InternalFPSMethod GetInternalFPSMethod();
+
+	void SetGSHeapStats(const GSHeapStats& stats);
+	const GSHeapStats& GetGSHeapStats();
 } // namespace PerformanceMetrics
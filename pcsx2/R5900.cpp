@@ -34,6 +34,7 @@
 #include "Elfheader.h"
 #include "CDVD/CDVD.h"
 #include "Patch.h"
+#include "DebugTools/GuestProfiler.h"
 
 #include "R5900OpcodeTables.h"
 
@@ -319,6 +320,10 @@ __fi void _cpuEventTest_Shared(void)
 	eeEventTestIsActive    = true;
 	cpuRegs.nextEventCycle = cpuRegs.cycle + EE_WAIT_CYCLES;
 	cpuRegs.lastEventCycle = cpuRegs.cycle;
+
+	if (EmuConfig.EnableGuestProfiler)
+		GuestProfiler::Sample();
+
 	// ---- INTC / DMAC (CPU-level Exceptions) -----------------
 	// Done first because exceptions raised during event tests need to be postponed a few
 	// cycles (fixes Grandia II [PAL], which does a spin loop on a vsync and expects to
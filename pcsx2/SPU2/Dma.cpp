@@ -153,7 +153,7 @@ void V_Core::FinishDMAwrite()
 
 	do
 	{
-		cacheLine->Validated = false;
+		cacheLine->Validated = 0;
 		cacheLine++;
 	} while (cacheLine != &cacheEnd);
 
@@ -14,45 +14,83 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 
 #include "Global.h"
 #include "spu2.h"
 #include "interpolate_table.h"
+#include "../GS/GSVector.h"
+#include "common/Threading.h"
+#include <libretro.h>
+
+extern retro_audio_sample_t sample_cb;
+
+static const s32 tbl_XA_Factor[16][2] =
+{
+	{0, 0},
+	{60, 0},
+	{115, -52},
+	{98, -55},
+	{122, -60}};
+
+// Filters 0 and 5-15 have no predictor terms, so their output doesn't depend on the
+// previous samples (and can't leave the s16 range, so no clamping either).
+static __forceinline bool XA_IsUnpredicted(s16 header)
+{
+	const int id = header >> 4 & 0xF;
+	return tbl_XA_Factor[id][0] == 0 && tbl_XA_Factor[id][1] == 0;
+}
 
 static void __forceinline XA_decode_block(s16* buffer, const s16* block, s32& prev1, s32& prev2)
 {
-	static const s32 tbl_XA_Factor[16][2] =
-	{
-		{0, 0},
-		{60, 0},
-		{115, -52},
-		{98, -55},
-		{122, -60}};
 	const s32 header = *block;
-	const s32 shift = (header & 0xF) + 16;
+	const int shift = header & 0xF;
 	const int id = header >> 4 & 0xF;
 	const s32 pred1 = tbl_XA_Factor[id][0];
 	const s32 pred2 = tbl_XA_Factor[id][1];
 
-	const s8* blockbytes = (s8*)&block[1];
-	const s8* blockend = &blockbytes[13];
-
-	for (; blockbytes <= blockend; ++blockbytes)
+	// Unpack all 28 nibbles and apply the shift up front, since that part doesn't depend
+	// on the previous samples. (nibble << 28) >> (shift + 16) is the same as doing it in
+	// 16 bits: (nibble << 12) >> shift.
+	const GSVector4i mask(static_cast<int>(0xF0F0F0F0));
+	const GSVector4i bytes = GSVector4i::load<false>(block).srl<2>();
+	const GSVector4i hi = bytes & mask;
+	const GSVector4i lo = bytes.sll16<4>() & mask;
+	const GSVector4i nib0 = lo.upl8(hi);
+	const GSVector4i nib1 = lo.uph8(hi);
+	const GSVector4i s0 = GSVector4i::zero().upl8(nib0).sra16(shift);
+	const GSVector4i s1 = GSVector4i::zero().uph8(nib0).sra16(shift);
+	const GSVector4i s2 = GSVector4i::zero().upl8(nib1).sra16(shift);
+	const GSVector4i s3 = GSVector4i::zero().uph8(nib1).sra16(shift);
+
+	if (pred1 == 0 && pred2 == 0)
 	{
-		s32 data = ((*blockbytes) << 28) & 0xF0000000;
-		s32 pcm = (data >> shift) + (((pred1 * prev1) + (pred2 * prev2) + 32) >> 6);
+		GSVector4i::store<false>(&buffer[0], s0);
+		GSVector4i::store<false>(&buffer[8], s1);
+		GSVector4i::store<false>(&buffer[16], s2);
+		GSVector4i::storel(&buffer[24], s3);
+
+		prev1 = buffer[27];
+		prev2 = buffer[26];
+		return;
+	}
 
-		pcm = std::clamp<s32>(pcm, -0x8000, 0x7fff);
-		*(buffer++) = pcm;
+	alignas(16) s16 data[32];
+	GSVector4i::store<true>(&data[0], s0);
+	GSVector4i::store<true>(&data[8], s1);
+	GSVector4i::store<true>(&data[16], s2);
+	GSVector4i::store<true>(&data[24], s3);
 
-		data = ((*blockbytes) << 24) & 0xF0000000;
-		s32 pcm2 = (data >> shift) + (((pred1 * pcm) + (pred2 * prev1) + 32) >> 6);
+	for (int i = 0; i < pcm_DecodedSamplesPerBlock; i++)
+	{
+		s32 pcm = data[i] + (((pred1 * prev1) + (pred2 * prev2) + 32) >> 6);
 
-		pcm2 = std::clamp<s32>(pcm2, -0x8000, 0x7fff);
-		*(buffer++) = pcm2;
+		pcm = std::clamp<s32>(pcm, -0x8000, 0x7fff);
+		buffer[i] = pcm;
 
-		prev2 = pcm;
-		prev1 = pcm2;
+		prev2 = prev1;
+		prev1 = pcm;
 	}
 }
 
@@ -142,24 +180,53 @@ static __forceinline s32 GetNextDataBuffered(V_Core& thiscore, V_Voice& vc, uint
 
 		const int cacheIdx = vc.NextA / pcm_WordsPerBlock;
 		PcmCacheEntry& cacheLine = pcm_cache_data[cacheIdx];
-		vc.SBuffer = cacheLine.Sampledata;
 
-		if (cacheLine.Validated && vc.Prev1 == cacheLine.Prev1 && vc.Prev2 == cacheLine.Prev2)
+		// Unpredicted blocks decode the same no matter what came before, so any valid way
+		// will do. Otherwise the previous samples have to match too.
+		const bool unpredicted = XA_IsUnpredicted(*memptr);
+		int way = -1;
+		for (int i = 0; i < pcm_CacheWays; i++)
+		{
+			const PcmCacheWay& w = cacheLine.Ways[i];
+			if ((cacheLine.Validated & (1 << i)) && (unpredicted || (vc.Prev1 == w.Prev1 && vc.Prev2 == w.Prev2)))
+			{
+				way = i;
+				break;
+			}
+		}
+
+		if (way >= 0)
 		{
 			// Cached block!  Read from the cache directly.
 			// Make sure to propagate the prev1/prev2 ADPCM:
 
+			cacheLine.MRU = way;
+			vc.SBuffer = cacheLine.Ways[way].Sampledata;
 			vc.Prev1 = vc.SBuffer[27];
 			vc.Prev2 = vc.SBuffer[26];
 		}
 		else
 		{
+			// Fill an empty way if there is one, otherwise replace the least recently used.
+			// Two ways is enough for the common case of a loop start block being entered both
+			// from the block before it and from the loop end.
+			if (!(cacheLine.Validated & 1))
+				way = 0;
+			else if (!(cacheLine.Validated & 2))
+				way = 1;
+			else
+				way = cacheLine.MRU ^ 1;
+
+			PcmCacheWay& w = cacheLine.Ways[way];
+			vc.SBuffer = w.Sampledata;
+
 			// Only flag the cache if it's a non-dynamic memory range.
 			if (vc.NextA >= SPU2_DYN_MEMLINE)
 			{
-				cacheLine.Validated = true;
-				cacheLine.Prev1 = vc.Prev1;
-				cacheLine.Prev2 = vc.Prev2;
+				cacheLine.Validated |= 1 << way;
+				cacheLine.MRU = way;
+				w.Prev1 = vc.Prev1;
+				w.Prev2 = vc.Prev2;
 			}
 
 			XA_decode_block(vc.SBuffer, memptr, vc.Prev1, vc.Prev2);
@@ -229,7 +296,7 @@ static __forceinline void CalculateADSR(V_Core& thiscore, V_Voice& vc, uint voic
 	}
 }
 
-static __forceinline s32 GetVoiceValues(V_Core& thiscore, V_Voice& vc, uint voiceidx)
+static __forceinline void FetchVoiceSamples(V_Core& thiscore, V_Voice& vc, uint voiceidx)
 {
 	while (vc.SP >= 0)
 	{
@@ -239,13 +306,23 @@ static __forceinline s32 GetVoiceValues(V_Core& thiscore, V_Voice& vc, uint voic
 		vc.PV1 = GetNextDataBuffered(thiscore, vc, voiceidx);
 		vc.SP -= 0x1000;
 	}
+}
 
+static __forceinline uint GetInterpIndex(const V_Voice& vc)
+{
 	const s32 mu = vc.SP + 0x1000;
+	return (mu & 0x0ff0) >> 4;
+}
+
+static __forceinline s32 GetVoiceValues(V_Core& thiscore, V_Voice& vc, uint voiceidx)
+{
+	FetchVoiceSamples(thiscore, vc, voiceidx);
+
 	s32 pv4      = vc.PV4;
 	s32 pv3      = vc.PV3;
 	s32 pv2      = vc.PV2;
 	s32 pv1      = vc.PV1;
-	s32   i      = (mu & 0x0ff0) >> 4;
+	uint  i      = GetInterpIndex(vc);
 
 	return (s32)(
 	   ((interpTable[i][0] * pv4) >> 15)
@@ -365,15 +442,30 @@ static void V_VolumeSlide_Update(V_VolumeSlide &vs)
 	}
 }
 
-static __forceinline StereoOut32 MixVoice(V_Core& thiscore, V_Voice& vc, uint coreidx, uint voiceidx)
+// Per-sample voice data gathered by MixCoreVoices.  The ADPCM fetch, pitch and envelope
+// steps have to run voice by voice (IRQs, ENDX and pitch modulation all depend on the
+// order), but interpolation, envelope/volume scaling and the gate masks do not, so they
+// are done for the whole core at once from these arrays.  The loops over them are
+// branch-free on purpose so the compiler can vectorize them.
+struct alignas(16) VoiceMixBatch
+{
+	s32 Tap[4][V_Core::NumVoices];
+	s32 Coef[4][V_Core::NumVoices];
+	s32 Env[V_Core::NumVoices];
+	s32 VolL[V_Core::NumVoices];
+	s32 VolR[V_Core::NumVoices];
+	s32 Deferred[V_Core::NumVoices]; // all bits set when the voice is computed in the batch
+	s32 OutL[V_Core::NumVoices];
+	s32 OutR[V_Core::NumVoices];
+	s32 OutX[V_Core::NumVoices];
+};
+
+static __forceinline void UpdateVoiceState(V_Core& thiscore, V_Voice& vc, uint coreidx, uint voiceidx)
 {
-	StereoOut32 voiceOut;
-	s32 Value      = 0;
-
 	// Most games don't use much volume slide effects.  So only call the UpdateVolume
 	// methods when needed by checking the flag outside the method here...
 	// (Note: Ys 6 : Ark of Nephistm uses these effects)
-	
+
 	if (vc.Volume.Left.Enable)
 		V_VolumeSlide_Update(vc.Volume.Left);
 	if (vc.Volume.Right.Enable)
@@ -384,60 +476,146 @@ static __forceinline StereoOut32 MixVoice(V_Core& thiscore, V_Voice& vc, uint co
 	// audible status.  Otherwise IRQs might not trigger and emulation might fail.
 
 	UpdatePitch(vc, coreidx, voiceidx);
+}
 
-	voiceOut.Left  = 0;
-	voiceOut.Right = 0;
+static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
+{
+	V_Core& thiscore(Cores[coreidx]);
+	VoiceMixBatch batch;
+	bool any_deferred = false;
 
-	if (vc.ADSR.Phase > PHASE_STOPPED)
+	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
 	{
-		if (vc.Noise)
-			Value = (s16)thiscore.NoiseOut;
-		else
-			Value = GetVoiceValues(thiscore, vc, voiceidx);
+		V_Voice& vc(thiscore.Voices[voiceidx]);
+		s32 Value = 0;
+
+		UpdateVoiceState(thiscore, vc, coreidx, voiceidx);
+
+		// Lanes that aren't filled in below must still hold sane values for the batch loop.
+		for (int tap = 0; tap < 4; tap++)
+		{
+			batch.Tap[tap][voiceidx]  = 0;
+			batch.Coef[tap][voiceidx] = 0;
+		}
+		batch.Env[voiceidx]      = 0;
+		batch.VolL[voiceidx]     = 0;
+		batch.VolR[voiceidx]     = 0;
+		batch.Deferred[voiceidx] = 0;
+		batch.OutL[voiceidx]     = 0;
+		batch.OutR[voiceidx]     = 0;
+
+		if (vc.ADSR.Phase > PHASE_STOPPED)
+		{
+			// The output has to be known right away for noise, for the voices that are
+			// written back to SPU2 RAM, and when the next voice is pitch modulated by it.
+			const bool needs_value_now = vc.Noise || voiceidx == 1 || voiceidx == 3 ||
+				(voiceidx + 1 < V_Core::NumVoices && thiscore.Voices[voiceidx + 1].Modulated);
+
+			if (needs_value_now)
+			{
+				if (vc.Noise)
+					Value = (s16)thiscore.NoiseOut;
+				else
+					Value = GetVoiceValues(thiscore, vc, voiceidx);
 
-		// Update and Apply ADSR  (applies to normal and noise sources)
+				// Update and Apply ADSR  (applies to normal and noise sources)
 
-		CalculateADSR(thiscore, vc, voiceidx);
-		Value     = (Value * vc.ADSR.Value) >> 15;
-		vc.OutX   = Value;
+				CalculateADSR(thiscore, vc, voiceidx);
+				Value     = (Value * vc.ADSR.Value) >> 15;
+				vc.OutX   = Value;
 
-		voiceOut.Left   = (Value * vc.Volume.Left.Value)  >> 15;
-		voiceOut.Right  = (Value * vc.Volume.Right.Value) >> 15;
+				batch.OutL[voiceidx] = (Value * vc.Volume.Left.Value)  >> 15;
+				batch.OutR[voiceidx] = (Value * vc.Volume.Right.Value) >> 15;
+			}
+			else
+			{
+				FetchVoiceSamples(thiscore, vc, voiceidx);
+				CalculateADSR(thiscore, vc, voiceidx);
+
+				const uint i = GetInterpIndex(vc);
+				batch.Tap[0][voiceidx]  = vc.PV4;
+				batch.Tap[1][voiceidx]  = vc.PV3;
+				batch.Tap[2][voiceidx]  = vc.PV2;
+				batch.Tap[3][voiceidx]  = vc.PV1;
+				batch.Coef[0][voiceidx] = interpTable[i][0];
+				batch.Coef[1][voiceidx] = interpTable[i][1];
+				batch.Coef[2][voiceidx] = interpTable[i][2];
+				batch.Coef[3][voiceidx] = interpTable[i][3];
+				batch.Env[voiceidx]     = vc.ADSR.Value;
+				batch.VolL[voiceidx]    = vc.Volume.Left.Value;
+				batch.VolR[voiceidx]    = vc.Volume.Right.Value;
+				batch.Deferred[voiceidx] = -1;
+				any_deferred = true;
+			}
+		}
+		else
+		{
+			while (vc.SP >= 0)
+				GetNextDataDummy(thiscore, vc, voiceidx); // Dummy is enough
+		}
+
+		// Write-back of raw voice data (post ADSR applied)
+		if (voiceidx == 1)
+			spu2M_WriteFast(((0 == coreidx) ? 0x400 : 0xc00) + OutPos, Value);
+		else if (voiceidx == 3)
+			spu2M_WriteFast(((0 == coreidx) ? 0x600 : 0xe00) + OutPos, Value);
 	}
-	else
+
+	// Voices which are keyed off don't touch the batch at all, so skip it entirely
+	// when nothing is playing (or everything playing was handled above).
+	if (any_deferred)
 	{
-		while (vc.SP >= 0)
-			GetNextDataDummy(thiscore, vc, voiceidx); // Dummy is enough
+		for (uint v = 0; v < V_Core::NumVoices; ++v)
+		{
+			s32 Value = ((batch.Coef[0][v] * batch.Tap[0][v]) >> 15)
+			          + ((batch.Coef[1][v] * batch.Tap[1][v]) >> 15)
+			          + ((batch.Coef[2][v] * batch.Tap[2][v]) >> 15)
+			          + ((batch.Coef[3][v] * batch.Tap[3][v]) >> 15);
+			Value = (Value * batch.Env[v]) >> 15;
+
+			const s32 mask = batch.Deferred[v];
+			batch.OutX[v] = Value;
+			batch.OutL[v] = (((Value * batch.VolL[v]) >> 15) & mask) | (batch.OutL[v] & ~mask);
+			batch.OutR[v] = (((Value * batch.VolR[v]) >> 15) & mask) | (batch.OutR[v] & ~mask);
+		}
+
+		for (uint v = 0; v < V_Core::NumVoices; ++v)
+		{
+			if (batch.Deferred[v])
+				thiscore.Voices[v].OutX = batch.OutX[v];
+		}
 	}
 
-	// Write-back of raw voice data (post ADSR applied)
-	if (voiceidx == 1)
-		spu2M_WriteFast(((0 == coreidx) ? 0x400 : 0xc00) + OutPos, Value);
-	else if (voiceidx == 3)
-		spu2M_WriteFast(((0 == coreidx) ? 0x600 : 0xe00) + OutPos, Value);
+	// Note: Voice outputs are ranged at 16 bits.
 
-	return voiceOut;
+	for (uint v = 0; v < V_Core::NumVoices; ++v)
+	{
+		dest.Dry.Left  += batch.OutL[v] & thiscore.VoiceGates[v].DryL;
+		dest.Dry.Right += batch.OutR[v] & thiscore.VoiceGates[v].DryR;
+		dest.Wet.Left  += batch.OutL[v] & thiscore.VoiceGates[v].WetL;
+		dest.Wet.Right += batch.OutR[v] & thiscore.VoiceGates[v].WetR;
+	}
 }
 
-static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
+StereoOut32 V_Core::Mix(const VoiceMixSet& inVoices, const StereoOut32& Input, const StereoOut32& Ext)
 {
-	V_Core& thiscore(Cores[coreidx]);
+	bool reverb;
+	StereoOut32 TD = MixDry(inVoices, Input, Ext, reverb);
 
-	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
+	if (reverb)
 	{
-		V_Voice& vc(thiscore.Voices[voiceidx]);
-		StereoOut32 VVal(MixVoice(thiscore, vc, coreidx, voiceidx));
+		const StereoOut32 RV = ReverbUpsample(RevbUpBuf, RevbSampleBufPos);
 
-		// Note: Results from MixVoice are ranged at 16 bits.
-
-		dest.Dry.Left  += VVal.Left  & thiscore.VoiceGates[voiceidx].DryL;
-		dest.Dry.Right += VVal.Right & thiscore.VoiceGates[voiceidx].DryR;
-		dest.Wet.Left  += VVal.Left  & thiscore.VoiceGates[voiceidx].WetL;
-		dest.Wet.Right += VVal.Right & thiscore.VoiceGates[voiceidx].WetR;
+		// Mix Dry + Wet
+		// (master volume is applied later to the result of both outputs added together).
+		TD.Left  += (RV.Left  * FxVol.Left)  >> 15;
+		TD.Right += (RV.Right * FxVol.Right) >> 15;
 	}
+
+	return TD;
 }
 
-StereoOut32 V_Core::Mix(const VoiceMixSet& inVoices, const StereoOut32& Input, const StereoOut32& Ext)
+StereoOut32 V_Core::MixDry(const VoiceMixSet& inVoices, const StereoOut32& Input, const StereoOut32& Ext, bool& reverb)
 {
 	StereoOut32 TD;
 	VoiceMixSet Voices;
@@ -511,23 +689,32 @@ StereoOut32 V_Core::Mix(const VoiceMixSet& inVoices, const StereoOut32& Input, c
 	TW.Left += Ext.Left & WetGate.ExtL;
 	TW.Right += Ext.Right & WetGate.ExtR;
 
-	StereoOut32 RV  = DoReverb(TW);
-
-	// Mix Dry + Wet
-	// (master volume is applied later to the result of both outputs added together).
-	TD.Left  += (RV.Left  * FxVol.Left)  >> 15;
-	TD.Right += (RV.Right * FxVol.Right) >> 15;
+	reverb = DoReverb(TW);
 	return TD;
 }
 
+// Core 1's final output doesn't feed back into SPU2 RAM, so everything from its reverb
+// upsampling onwards is kept in an OutputSample. That can be finished right away (Mix()),
+// or in blocks on the output thread (MixQueued()).
+struct OutputSample
+{
+	StereoOut32 Dry; // Core 1 dry mix, or the CDDA feed when Direct is set
+	s16 Reverb[2]; // Sample core 1's reverb appended to RevbUpBuf
+	s32 FxVol[2];
+	s32 MasterVol[2];
+	bool HasReverb;
+	bool Direct;
+	bool Emit;
+};
+
 // Gcc does not want to inline it when lto is enabled because some functions growth too much.
 // The function is big enought to see any speed impact. -- Gregory
+static
 #ifndef __POSIX__
 __forceinline
 #endif
-void Mix(short *out_left, short *out_right)
+void MixCores(OutputSample& Out)
 {
-	StereoOut32 Out;
 	StereoOut32 empty;
 	StereoOut32 Ext;
 	// Note: Playmode 4 is SPDIF, which overrides other inputs.
@@ -583,18 +770,52 @@ void Mix(short *out_left, short *out_right)
 
 	Ext.Left  = (Ext.Left  * Cores[1].ExtVol.Left)  >> 15;
 	Ext.Right = (Ext.Right * Cores[1].ExtVol.Right) >> 15;
-	Out       = Cores[1].Mix(VoiceData[1], InputData[1], Ext);
+	Out.Dry   = Cores[1].MixDry(VoiceData[1], InputData[1], Ext, Out.HasReverb);
+
+	if (Out.HasReverb)
+	{
+		const u32 pos = (Cores[1].RevbSampleBufPos - 1) & 63;
+		Out.Reverb[0] = Cores[1].RevbUpBuf[0][pos];
+		Out.Reverb[1] = Cores[1].RevbUpBuf[1][pos];
+		Out.FxVol[0]  = Cores[1].FxVol.Left;
+		Out.FxVol[1]  = Cores[1].FxVol.Right;
+	}
 
 	// Experimental CDDA support
 	// The CDDA overrides all other mixer output.  It's a direct feed!
-	if (PlayMode & 8)
-		Out       = Cores[1].ReadInput_HiFi();
+	Out.Direct = (PlayMode & 8) != 0;
+	if (Out.Direct)
+		Out.Dry = Cores[1].ReadInput_HiFi();
 	else
 	{
+		Out.MasterVol[0] = Cores[1].MasterVol.Left.Value;
+		Out.MasterVol[1] = Cores[1].MasterVol.Right.Value;
+	}
+
+	// Update AutoDMA output positioning
+	OutPos++;
+	if (OutPos >= 0x200)
+		OutPos = 0;
+}
+
+// up_buf/up_pos must already hold the sample's reverb output.
+static __forceinline void FinishSample(const OutputSample& In, const s16 (&up_buf)[2][64 * 2], u32 up_pos, short *out_left, short *out_right)
+{
+	StereoOut32 Out = In.Dry;
+
+	if (!In.Direct)
+	{
+		if (In.HasReverb)
+		{
+			const StereoOut32 RV = ReverbUpsample(up_buf, up_pos);
+			Out.Left  += (RV.Left  * In.FxVol[0]) >> 15;
+			Out.Right += (RV.Right * In.FxVol[1]) >> 15;
+		}
+
 		Out.Left  = std::clamp(Out.Left,  -0x8000, 0x7fff);
 		Out.Right = std::clamp(Out.Right, -0x8000, 0x7fff);
-		Out.Left  = (Out.Left  * Cores[1].MasterVol.Left.Value)  >> 15;
-		Out.Right = (Out.Right * Cores[1].MasterVol.Right.Value) >> 15;
+		Out.Left  = (Out.Left  * In.MasterVol[0]) >> 15;
+		Out.Right = (Out.Right * In.MasterVol[1]) >> 15;
 	}
 
 	// A simple DC blocking high-pass filter
@@ -608,9 +829,141 @@ void Mix(short *out_left, short *out_right)
 	// Final clamp, take care not to exceed 16 bits from here on
 	*out_left         = (int16_t)(std::clamp(DCFilterOut.Left,  -0x8000, 0x7fff));
 	*out_right        = (int16_t)(std::clamp(DCFilterOut.Right, -0x8000, 0x7fff));
+}
 
-	// Update AutoDMA output positioning
-	OutPos++;
-	if (OutPos >= 0x200)
-		OutPos = 0;
+// --------------------------------------------------------------------------------------
+//  Threaded output (EmuConfig.Speedhacks.spu2Thread)
+// --------------------------------------------------------------------------------------
+// MixQueued() runs MixCores() on the IOP thread and collects the OutputSamples into
+// blocks. A worker thread does core 1's reverb upsampling FIR, the effect and master
+// volumes, the DC filter and the hand-off to the frontend for each block. It keeps its
+// own copy of core 1's reverb upsample buffer, taken when threaded output starts and
+// then fed with each sample's reverb output. Two blocks are used; the IOP thread only
+// waits when it fills one before the worker is done with the other.
+
+static constexpr u32 OUTPUT_BLOCK_SIZE = 64;
+
+struct OutputBlock
+{
+	OutputSample Samples[OUTPUT_BLOCK_SIZE];
+	u32 Count;
+};
+
+static OutputBlock s_output_blocks[2];
+static OutputBlock* s_output_fill = &s_output_blocks[0];
+static bool s_output_active = false;
+
+alignas(32) static s16 s_output_revb_up_buf[2][64 * 2];
+static u32 s_output_revb_pos = 0;
+
+static Threading::Thread s_output_thread;
+static Threading::WorkSema s_output_sema;
+static std::atomic<OutputBlock*> s_output_job{nullptr};
+static std::atomic<bool> s_output_exit{false};
+
+static void WriteOutputBlock(const OutputBlock& block)
+{
+	for (u32 i = 0; i < block.Count; i++)
+	{
+		const OutputSample& sample = block.Samples[i];
+		if (sample.HasReverb)
+		{
+			// Same bookkeeping as V_Core::DoReverb().
+			const u32 pos = s_output_revb_pos;
+			s_output_revb_up_buf[0][pos] = s_output_revb_up_buf[0][pos | 64] = sample.Reverb[0];
+			s_output_revb_up_buf[1][pos] = s_output_revb_up_buf[1][pos | 64] = sample.Reverb[1];
+			s_output_revb_pos = (pos + 1) & 63;
+		}
+
+		short left, right;
+		FinishSample(sample, s_output_revb_up_buf, s_output_revb_pos, &left, &right);
+
+		if (sample.Emit && sample_cb && left != 0 && right != 0)
+			sample_cb(left, right);
+	}
+}
+
+static void OutputThreadProc()
+{
+	for (;;)
+	{
+		s_output_sema.WaitForWork();
+		if (s_output_exit.load(std::memory_order_acquire))
+			break;
+
+		if (OutputBlock* block = s_output_job.exchange(nullptr, std::memory_order_acq_rel))
+			WriteOutputBlock(*block);
+	}
+}
+
+static void SubmitOutputBlock()
+{
+	if (!s_output_thread.Joinable())
+		s_output_thread.Start(OutputThreadProc);
+	else
+		s_output_sema.WaitForEmpty();
+
+	// The worker is done with the other block now, so it can be refilled.
+	s_output_job.store(s_output_fill, std::memory_order_release);
+	s_output_sema.NotifyOfWork();
+
+	s_output_fill = (s_output_fill == &s_output_blocks[0]) ? &s_output_blocks[1] : &s_output_blocks[0];
+	s_output_fill->Count = 0;
+}
+
+void Mix(short *out_left, short *out_right)
+{
+	// Switched from threaded output, the worker owns the DC filter until it's done.
+	if (s_output_active)
+		MixFlush();
+
+	OutputSample sample;
+	MixCores(sample);
+	FinishSample(sample, Cores[1].RevbUpBuf, Cores[1].RevbSampleBufPos, out_left, out_right);
+}
+
+void MixQueued(bool emit)
+{
+	if (!s_output_active)
+	{
+		// The worker is idle, pick up the reverb history it'll be upsampling from.
+		std::memcpy(s_output_revb_up_buf, Cores[1].RevbUpBuf, sizeof(s_output_revb_up_buf));
+		s_output_revb_pos = Cores[1].RevbSampleBufPos;
+		s_output_active = true;
+	}
+
+	OutputBlock& block = *s_output_fill;
+	OutputSample& sample = block.Samples[block.Count];
+	MixCores(sample);
+	sample.Emit = emit;
+
+	if (++block.Count == OUTPUT_BLOCK_SIZE)
+		SubmitOutputBlock();
+}
+
+void MixFlush()
+{
+	if (!s_output_active)
+		return;
+
+	if (s_output_fill->Count > 0)
+		SubmitOutputBlock();
+
+	s_output_sema.WaitForEmpty();
+	s_output_active = false;
+}
+
+void MixShutdown()
+{
+	MixFlush();
+
+	if (!s_output_thread.Joinable())
+		return;
+
+	s_output_exit.store(true, std::memory_order_release);
+	s_output_sema.NotifyOfWork();
+	s_output_thread.Join();
+
+	s_output_exit.store(false, std::memory_order_relaxed);
+	s_output_sema.Reset();
 }
@@ -16,3 +16,11 @@
 #pragma once
 
 extern void Mix(short *left, short *right);
+
+// Threaded output: mixes a sample and queues it for the output thread. Only samples
+// queued with emit set are passed on to the frontend.
+extern void MixQueued(bool emit);
+// Waits until every queued sample has been written out.
+extern void MixFlush();
+// Flushes and stops the output thread.
+extern void MixShutdown();
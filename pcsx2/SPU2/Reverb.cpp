@@ -26,14 +26,12 @@ __forceinline s32 V_Core::RevbGetIndexer(s32 offset)
 	return ((x + start) & 0xf'ffff);
 }
 
-StereoOut32 V_Core::DoReverb(StereoOut32 Input)
+// Runs the reverb over the effects work area and appends its output to RevbUpBuf.
+// Returns false without touching anything when there's no work area.
+bool V_Core::DoReverb(StereoOut32 Input)
 {
 	if (EffectsStartA >= EffectsEndA)
-	{
-		StereoOut32 ret;
-		ret.Left = ret.Right = 0;
-		return ret;
-	}
+		return false;
 
 	Input.Left  = std::clamp(Input.Left, -0x8000, 0x7fff);
 	Input.Right = std::clamp(Input.Right, -0x8000, 0x7fff);
@@ -128,5 +126,5 @@ StereoOut32 V_Core::DoReverb(StereoOut32 Input)
 
 	RevbSampleBufPos = (RevbSampleBufPos + 1) & 63;
 
-	return ReverbUpsample(*this);
+	return true;
 }
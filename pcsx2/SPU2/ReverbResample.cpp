@@ -137,16 +137,16 @@ s32 ReverbDownsample(V_Core& core, bool right)
 #endif
 }
 
-StereoOut32 __forceinline ReverbUpsample_reference(V_Core& core)
+StereoOut32 __forceinline ReverbUpsample_reference(const s16 (&up_buf)[2][64 * 2], u32 buf_pos)
 {
 	StereoOut32 val;
-	int index = (core.RevbSampleBufPos - NUM_TAPS) & 63;
+	int index = (buf_pos - NUM_TAPS) & 63;
 	s32 l = 0, r = 0;
 
 	for (u32 i = 0; i < NUM_TAPS; i++)
 	{
-		l += core.RevbUpBuf[0][index + i] * filter_up_coefs[i];
-		r += core.RevbUpBuf[1][index + i] * filter_up_coefs[i];
+		l += up_buf[0][index + i] * filter_up_coefs[i];
+		r += up_buf[1][index + i] * filter_up_coefs[i];
 	}
 
 	val.Left  = std::clamp(l >> 15, -0x8000, 0x7fff);
@@ -155,26 +155,26 @@ StereoOut32 __forceinline ReverbUpsample_reference(V_Core& core)
 }
 
 #if _M_SSE >= 0x501
-StereoOut32 __forceinline ReverbUpsample_avx(V_Core& core)
+StereoOut32 __forceinline ReverbUpsample_avx(const s16 (&up_buf)[2][64 * 2], u32 buf_pos)
 {
-	int index = (core.RevbSampleBufPos - NUM_TAPS) & 63;
+	int index = (buf_pos - NUM_TAPS) & 63;
 
 	auto c = GSVector8i::load<true>(&filter_up_coefs[0]);
-	auto l = GSVector8i::load<false>(&core.RevbUpBuf[0][index]);
-	auto r = GSVector8i::load<false>(&core.RevbUpBuf[1][index]);
+	auto l = GSVector8i::load<false>(&up_buf[0][index]);
+	auto r = GSVector8i::load<false>(&up_buf[1][index]);
 
 	auto lacc = l.mul16hrs(c);
 	auto racc = r.mul16hrs(c);
 
 	c = GSVector8i::load<true>(&filter_up_coefs[16]);
-	l = GSVector8i::load<false>(&core.RevbUpBuf[0][index + 16]);
-	r = GSVector8i::load<false>(&core.RevbUpBuf[1][index + 16]);
+	l = GSVector8i::load<false>(&up_buf[0][index + 16]);
+	r = GSVector8i::load<false>(&up_buf[1][index + 16]);
 	lacc = lacc.adds16(l.mul16hrs(c));
 	racc = racc.adds16(r.mul16hrs(c));
 
 	c = GSVector8i::load<true>(&filter_up_coefs[32]);
-	l = GSVector8i::load<false>(&core.RevbUpBuf[0][index + 32]);
-	r = GSVector8i::load<false>(&core.RevbUpBuf[1][index + 32]);
+	l = GSVector8i::load<false>(&up_buf[0][index + 32]);
+	r = GSVector8i::load<false>(&up_buf[1][index + 32]);
 	lacc = lacc.adds16(l.mul16hrs(c));
 	racc = racc.adds16(r.mul16hrs(c));
 
@@ -193,38 +193,38 @@ StereoOut32 __forceinline ReverbUpsample_avx(V_Core& core)
 }
 #endif
 
-StereoOut32 __forceinline ReverbUpsample_sse(V_Core& core)
+StereoOut32 __forceinline ReverbUpsample_sse(const s16 (&up_buf)[2][64 * 2], u32 buf_pos)
 {
-	int index = (core.RevbSampleBufPos - NUM_TAPS) & 63;
+	int index = (buf_pos - NUM_TAPS) & 63;
 
 	auto c = GSVector4i::load<true>(&filter_up_coefs[0]);
-	auto l = GSVector4i::load<false>(&core.RevbUpBuf[0][index]);
-	auto r = GSVector4i::load<false>(&core.RevbUpBuf[1][index]);
+	auto l = GSVector4i::load<false>(&up_buf[0][index]);
+	auto r = GSVector4i::load<false>(&up_buf[1][index]);
 
 	auto lacc = l.mul16hrs(c);
 	auto racc = r.mul16hrs(c);
 
 	c = GSVector4i::load<true>(&filter_up_coefs[8]);
-	l = GSVector4i::load<false>(&core.RevbUpBuf[0][index + 8]);
-	r = GSVector4i::load<false>(&core.RevbUpBuf[1][index + 8]);
+	l = GSVector4i::load<false>(&up_buf[0][index + 8]);
+	r = GSVector4i::load<false>(&up_buf[1][index + 8]);
 	lacc = lacc.adds16(l.mul16hrs(c));
 	racc = racc.adds16(r.mul16hrs(c));
 
 	c = GSVector4i::load<true>(&filter_up_coefs[16]);
-	l = GSVector4i::load<false>(&core.RevbUpBuf[0][index + 16]);
-	r = GSVector4i::load<false>(&core.RevbUpBuf[1][index + 16]);
+	l = GSVector4i::load<false>(&up_buf[0][index + 16]);
+	r = GSVector4i::load<false>(&up_buf[1][index + 16]);
 	lacc = lacc.adds16(l.mul16hrs(c));
 	racc = racc.adds16(r.mul16hrs(c));
 
 	c = GSVector4i::load<true>(&filter_up_coefs[24]);
-	l = GSVector4i::load<false>(&core.RevbUpBuf[0][index + 24]);
-	r = GSVector4i::load<false>(&core.RevbUpBuf[1][index + 24]);
+	l = GSVector4i::load<false>(&up_buf[0][index + 24]);
+	r = GSVector4i::load<false>(&up_buf[1][index + 24]);
 	lacc = lacc.adds16(l.mul16hrs(c));
 	racc = racc.adds16(r.mul16hrs(c));
 
 	c = GSVector4i::load<true>(&filter_up_coefs[32]);
-	l = GSVector4i::load<false>(&core.RevbUpBuf[0][index + 32]);
-	r = GSVector4i::load<false>(&core.RevbUpBuf[1][index + 32]);
+	l = GSVector4i::load<false>(&up_buf[0][index + 32]);
+	r = GSVector4i::load<false>(&up_buf[1][index + 32]);
 	lacc = lacc.adds16(l.mul16hrs(c));
 	racc = racc.adds16(r.mul16hrs(c));
 
@@ -239,12 +239,12 @@ StereoOut32 __forceinline ReverbUpsample_sse(V_Core& core)
 	return {lacc.I16[0], racc.I16[0]};
 }
 
-StereoOut32 ReverbUpsample(V_Core& core)
+StereoOut32 ReverbUpsample(const s16 (&up_buf)[2][64 * 2], u32 buf_pos)
 {
 #if _M_SSE >= 0x501
-	return ReverbUpsample_avx(core);
+	return ReverbUpsample_avx(up_buf, buf_pos);
 #else
-	return ReverbUpsample_sse(core);
+	return ReverbUpsample_sse(up_buf, buf_pos);
 #endif
 }
 
@@ -400,7 +400,10 @@ struct V_Core
 	// --------------------------------------------------------------------------------------
 
 	StereoOut32 Mix(const VoiceMixSet& inVoices, const StereoOut32& Input, const StereoOut32& Ext);
-	StereoOut32 DoReverb(StereoOut32 Input);
+	// Mix() up to the reverb work area update, without adding the upsampled reverb output.
+	// reverb is set when DoReverb() wrote a new sample to RevbUpBuf.
+	StereoOut32 MixDry(const VoiceMixSet& inVoices, const StereoOut32& Input, const StereoOut32& Ext, bool& reverb);
+	bool DoReverb(StereoOut32 Input);
 	s32 RevbGetIndexer(s32 offset);
 
 	StereoOut32 ReadInput();
@@ -438,11 +441,11 @@ struct V_Core
 };
 
 MULTI_ISA_DEF(
-	StereoOut32 ReverbUpsample(V_Core& core);
+	StereoOut32 ReverbUpsample(const s16 (&up_buf)[2][64 * 2], u32 buf_pos);
 	s32 ReverbDownsample(V_Core& core, bool right);
 )
 
-extern StereoOut32 (*ReverbUpsample)(V_Core& core);
+extern StereoOut32 (*ReverbUpsample)(const s16 (&up_buf)[2][64 * 2], u32 buf_pos);
 extern s32 (*ReverbDownsample)(V_Core& core, bool right);
 
 extern bool has_to_call_irq[2];
@@ -465,6 +468,8 @@ namespace SPU2Savestate
 //  Thus: pcm_cache_data = 7,340,032 bytes (ouch!)
 //  Expanded: 16 bytes expands to 56 bytes [3.5:1 ratio]
 //    Resulting in 2MB * 3.5.
+//  Each block keeps two decodes (ways), since a block's output depends on the two samples
+//  decoded before it, and loop start blocks are regularly entered with two different ones.
 
 // The SPU2 has a dynamic memory range which is used for several internal operations, such as
 // registers, CORE 1/2 mixing, AutoDMAs, and some other fancy stuff.  We exclude this range
@@ -480,12 +485,21 @@ static constexpr int pcm_BlockCount = 0x100000 / pcm_WordsPerBlock;
 // 28 samples per decoded PCM block (as stored in our cache)
 static constexpr int pcm_DecodedSamplesPerBlock = 28;
 
-struct PcmCacheEntry
+// number of decodes kept per ADPCM block
+static constexpr int pcm_CacheWays = 2;
+
+struct PcmCacheWay
 {
-	bool Validated;
 	s16 Sampledata[pcm_DecodedSamplesPerBlock];
-	s32 Prev1;
-	s32 Prev2;
+	s16 Prev1;
+	s16 Prev2;
+};
+
+struct PcmCacheEntry
+{
+	u8 Validated; // one bit per way, clear to invalidate the block
+	u8 MRU;
+	PcmCacheWay Ways[pcm_CacheWays];
 };
 
 extern PcmCacheEntry pcm_cache_data[pcm_BlockCount];
@@ -29,6 +29,8 @@ u32 lClocks = 0;
 
 static void SPU2_InternalReset(bool psxmode)
 {
+	MixFlush();
+
 	s_psxmode = psxmode;
 	if (!s_psxmode)
 	{
@@ -54,8 +56,8 @@ void SPU2::Open()
 	SPU2_InternalReset(false);
 }
 
-void SPU2::Close() { }
-void SPU2::Shutdown() { }
+void SPU2::Close() { MixFlush(); }
+void SPU2::Shutdown() { MixShutdown(); }
 bool SPU2::IsRunningPSXMode() { return s_psxmode; }
 
 u16 SPU2read(u32 rmem)
@@ -127,6 +129,8 @@ s32 SPU2freeze(FreezeAction mode, freezeData* data)
 		switch (mode)
 		{
 			case FreezeAction::Load:
+				// The output thread's copy of the reverb history is about to go stale.
+				MixFlush();
 				return SPU2Savestate::ThawIt(spud);
 			case FreezeAction::Save:
 				SPU2Savestate::FreezeIt(spud);
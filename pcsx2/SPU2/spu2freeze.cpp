@@ -138,7 +138,7 @@ s32 SPU2Savestate::ThawIt(DataBlock& spud)
 			for (int v = 0; v < 24; v++)
 			{
 				const int cacheIdx = Cores[c].Voices[v].NextA / pcm_WordsPerBlock;
-				Cores[c].Voices[v].SBuffer = pcm_cache_data[cacheIdx].Sampledata;
+				Cores[c].Voices[v].SBuffer = pcm_cache_data[cacheIdx].Ways[0].Sampledata;
 			}
 		}
 	}
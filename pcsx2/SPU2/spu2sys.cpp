@@ -23,6 +23,7 @@
 #include "../IopDma.h"
 #include "../IopHw.h"
 #include "../R3000A.h"
+#include "../Config.h"
 #include "Dma.h"
 #include "Global.h"
 #include "spu2.h"
@@ -45,7 +46,7 @@ int PlayMode;
 
 bool has_to_call_irq[2]     = { false, false };
 bool has_to_call_irq_dma[2] = { false, false };
-StereoOut32 (*ReverbUpsample)(V_Core& core);
+StereoOut32 (*ReverbUpsample)(const s16 (&up_buf)[2][64 * 2], u32 buf_pos);
 s32 (*ReverbDownsample)(V_Core& core, bool right);
 
 static bool psxmode = false;
@@ -61,7 +62,7 @@ __forceinline void spu2M_Write(u32 addr, s16 value)
 	if (addr >= SPU2_DYN_MEMLINE)
 	{
 		const int cacheIdx = addr / pcm_WordsPerBlock;
-		pcm_cache_data[cacheIdx].Validated = false;
+		pcm_cache_data[cacheIdx].Validated = 0;
 	}
 	*GetMemPtr(addr) = value;
 }
@@ -209,6 +210,8 @@ __forceinline void TimeUpdate(u32 cClocks)
 
 	snd_buffer[0] = snd_buffer[1] = 0;
 
+	const bool threaded_output = EmuConfig.Speedhacks.spu2Thread;
+
 	//Update Mixing Progress
 	while (dClocks >= TICKINTERVAL)
 	{
@@ -268,10 +271,15 @@ __forceinline void TimeUpdate(u32 cClocks)
 				}
 			}
 		}
-		Mix(&snd_buffer[0], &snd_buffer[1]);
+
+		// Only the last sample of each update goes to the frontend.
+		if (threaded_output)
+			MixQueued(dClocks < TICKINTERVAL);
+		else
+			Mix(&snd_buffer[0], &snd_buffer[1]);
 	}
 
-	if (sample_cb && snd_buffer[0] != 0 && snd_buffer[1] != 0)
+	if (!threaded_output && sample_cb && snd_buffer[0] != 0 && snd_buffer[1] != 0)
 		sample_cb(snd_buffer[0], snd_buffer[1]);
 
 	//Update DMA4 interrupt delay counter
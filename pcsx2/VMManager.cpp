@@ -26,6 +26,7 @@
 #include "common/Console.h"
 #include "common/FileSystem.h"
 #include "common/FPControl.h"
+#include "common/Perf.h"
 #include "common/SettingsWrapper.h"
 #include "common/StringUtil.h" /* StdStringFromFormat */
 #include "common/Threading.h"
@@ -40,6 +41,7 @@
 #include "GS/Renderers/HW/GSTextureReplacements.h"
 #include "Host.h"
 #include "IopBios.h"
+#include "IPU/IPUThread.h"
 #include "MTVU.h"
 #include "MemoryCardFile.h"
 #include "Patch.h"
@@ -57,6 +59,7 @@
 #include "Sio.h"
 #include "ps2/BiosTools.h"
 
+#include "DebugTools/GuestProfiler.h"
 #include "DebugTools/MIPSAnalyst.h"
 
 #ifdef _WIN32
@@ -233,6 +236,7 @@ void VMManager::Internal::CPUThreadShutdown(void)
 
 	ShutdownCPUProviders();
 	s_vm_memory.reset();
+	Perf::Shutdown();
 
 	USBshutdown();
 	SPU2::Shutdown();
@@ -653,6 +657,19 @@ void VMManager::Shutdown()
 	if (THREAD_VU1)
 		vu1Thread.WaitVU();
 	MTGS::WaitGS(false);
+	IPUThread::Shutdown();
+
+	GuestProfiler::Dump(s_game_serial);
+
+	// only filled in when the software renderer ran, and stable now that the GS thread has been synced
+	const PerformanceMetrics::GSHeapStats& heap_stats = PerformanceMetrics::GetGSHeapStats();
+	if (heap_stats.allocations > 0)
+	{
+		Console.WriteLn("GS vertex heap: %llu allocations totalling %llu KB, buffer grew %u times to %llu KB",
+			static_cast<unsigned long long>(heap_stats.allocations),
+			static_cast<unsigned long long>(heap_stats.bytes_allocated / 1024), heap_stats.buffer_grows,
+			static_cast<unsigned long long>(heap_stats.buffer_size / 1024));
+	}
 
 	{
 		LastELF.clear();
@@ -37,6 +37,7 @@
 #include "common/AlignedMalloc.h"
 #include "common/FileSystem.h"
 #include "common/Path.h"
+#include "common/Perf.h"
 
 using namespace x86Emitter;
 
@@ -105,7 +106,7 @@ alignas(__pagesize) static u8 iopRecDispatchers[__pagesize];
 
 static const void* iopDispatcherEvent = NULL;
 static const void* iopDispatcherReg = NULL;
-static const void* iopJITCompile = NULL;
+const void* iopJITCompile = NULL;
 static const void* iopEnterRecompiledCode = NULL;
 static const void* iopExitRecompiledCode = NULL;
 
@@ -195,6 +196,8 @@ static void _DynGen_Dispatchers(void)
 	iopJITCompile = _DynGen_JITCompile();
 	iopEnterRecompiledCode = _DynGen_EnterRecompiledCode();
 
+	Perf::RegisterCode(Perf::Subsystem::IOP, iopRecDispatchers, static_cast<u32>(xGetPtr() - iopRecDispatchers), "Dispatchers");
+
 	mode.m_write = false;
 	mode.m_exec  = true;
 	HostSys::MemProtect(iopRecDispatchers, __pagesize, mode);
@@ -1190,6 +1193,9 @@ static void iopRecRecompile(const u32 startpc)
 	s_pCurBlock->m_pFnptr = ((uptr)x86Ptr);
 	s_psxBlockCycles = 0;
 
+	if (u32* counter = Perf::AllocateBlockCounter(Perf::Subsystem::IOP, HWADDR(startpc)))
+		xADD(ptr32[xComplexAddress(rax, counter, xAddressVoid())], 1);
+
 	// reset recomp state variables
 	psxpc = startpc;
 	g_psxHasConstReg = g_psxFlushedConstReg = 1;
@@ -1339,6 +1345,7 @@ StartRecomp:
 	}
 
 	s_pCurBlockEx->x86size = xGetPtr() - recPtr;
+	Perf::RegisterBlock(Perf::Subsystem::IOP, recPtr, s_pCurBlockEx->x86size, HWADDR(startpc));
 
 	recPtr = xGetPtr();
 
@@ -16,6 +16,7 @@
 #include <time.h>
 
 #include "iR3000A.h"
+#include "BaseblockEx.h"
 #include "IopMem.h"
 #include "IopDma.h"
 #include "IopGte.h"
@@ -24,6 +25,7 @@ using namespace x86Emitter;
 
 extern int g_psxWriteOk;
 extern u32 g_psxMaxRecMem;
+extern const void* iopJITCompile;
 
 // R3000A instruction implementation
 #define REC_FUNC(f) \
@@ -1022,9 +1024,19 @@ PSXRECOMPILE_CONSTCODE3_PENALTY(DIVU, 1, psxInstCycles_Div);
 
 // TLB loadstore functions
 
+// Returns a host pointer into IOP RAM when the effective address is known at
+// compile time. Stores always take the runtime path, since they have to check
+// for cache isolation and invalidate recompiled code.
 static u8* rpsxGetConstantAddressOperand(bool store)
 {
-	return nullptr;
+	if (store || !PSX_IS_CONST1(_Rs_))
+		return nullptr;
+
+	const u32 addr = g_psxConstRegs[_Rs_] + _Imm_;
+	if (addr & 0x10000000)
+		return nullptr;
+
+	return &iopMem->Main[addr & 0x1fffff];
 }
 
 static void rpsxCalcAddressOperand()
@@ -1064,8 +1076,45 @@ static void rpsxCalcStoreOperand()
 		xMOV(arg2regd, ptr32[&psxRegs.GPR.r[_Rt_]]);
 }
 
+static void rpsxLoadConstant(u8* ptr, int size, bool sign)
+{
+	if (_Rt_ == 0)
+		return;
+
+	PSX_DEL_CONST(_Rt_);
+	_deletePSXtoX86reg(_Rt_, DELETE_REG_FREE_NO_WRITEBACK);
+
+	const int rt = rpsxAllocRegIfUsed(_Rt_, MODE_WRITE);
+	const xRegister32 dreg((rt < 0) ? eax.Id : rt);
+	auto addr = xComplexAddress(rax, ptr, xAddressVoid());
+
+	switch (size)
+	{
+		case 8:
+			sign ? xMOVSX(dreg, ptr8[addr]) : xMOVZX(dreg, ptr8[addr]);
+			break;
+		case 16:
+			sign ? xMOVSX(dreg, ptr16[addr]) : xMOVZX(dreg, ptr16[addr]);
+			break;
+		case 32:
+			xMOV(dreg, ptr32[addr]);
+			break;
+		default:
+			break;
+	}
+
+	if (rt < 0)
+		xMOV(ptr32[&psxRegs.GPR.r[_Rt_]], eax);
+}
+
 static void rpsxLoad(int size, bool sign)
 {
+	if (u8* ptr = rpsxGetConstantAddressOperand(false))
+	{
+		rpsxLoadConstant(ptr, size, sign);
+		return;
+	}
+
 	rpsxCalcAddressOperand();
 
 	if (_Rt_ != 0)
@@ -1179,36 +1228,88 @@ static void rpsxLW()
 	rpsxLoad(32, false);
 }
 
-static void rpsxSB()
+static void rpsxStore(int size)
 {
 	rpsxCalcAddressOperand();
 	rpsxCalcStoreOperand();
 	_psxFlushCall(FLUSH_FULLVTLB);
-	xFastCall((void*)iopMemWrite8);
+
+	// RAM writes go straight to psM, unless the cache is isolated (the
+	// BIOS does this while flushing the I-cache), in which case the handler
+	// drops them.
+	xTEST(arg1regd, 0x10000000);
+	xForwardJump32 not_ram(Jcc_NotZero);
+	xTEST(ptr32[&psxRegs.CP0.n.Status], 0x10000);
+	xForwardJump32 isolated(Jcc_NotZero);
+
+	xAND(arg1regd, 0x1fffff);
+	auto addr = xComplexAddress(rax, iopMem->Main, arg1reg);
+	switch (size)
+	{
+		case 8:
+			xMOV(ptr8[addr], xRegister8(arg2regd));
+			break;
+		case 16:
+			xMOV(ptr16[addr], xRegister16(arg2regd));
+			break;
+		case 32:
+			xMOV(ptr32[addr], arg2regd);
+			break;
+		default:
+			break;
+	}
+
+	// Same test as PSXREC_CLEARM()/psxRecClearMem(): only a block starting
+	// at the written word needs to be thrown away.
+	xAND(arg1regd, ~3);
+	xCMP(arg1regd, ptr32[&g_psxMaxRecMem]);
+	xForwardJump8 no_code(Jcc_AboveOrEqual);
+	xMOV(eax, arg1regd);
+	xSHR(eax, 16);
+	xMOV(rax, ptrNative[xComplexAddress(arg3reg, psxRecLUT, rax * wordsize)]);
+	xMOV(rax, ptrNative[arg1reg * (sizeof(BASEBLOCK) / 4) + rax]);
+	xMOV64(arg3reg, (sptr)iopJITCompile);
+	xCMP(rax, arg3reg);
+	xForwardJE8 not_compiled;
+	xMOV(arg2regd, 1);
+	xFastCall((void*)psxRec.Clear, arg1regd, arg2regd);
+	no_code.SetTarget();
+	not_compiled.SetTarget();
+	xForwardJump8 done;
+
+	not_ram.SetTarget();
+	isolated.SetTarget();
+	switch (size)
+	{
+		case 8:
+			xFastCall((void*)iopMemWrite8);
+			break;
+		case 16:
+			xFastCall((void*)iopMemWrite16);
+			break;
+		case 32:
+			xFastCall((void*)iopMemWrite32);
+			break;
+		default:
+			break;
+	}
+
+	done.SetTarget();
+}
+
+static void rpsxSB()
+{
+	rpsxStore(8);
 }
 
 static void rpsxSH()
 {
-	rpsxCalcAddressOperand();
-	rpsxCalcStoreOperand();
-	_psxFlushCall(FLUSH_FULLVTLB);
-	xFastCall((void*)iopMemWrite16);
+	rpsxStore(16);
 }
 
 static void rpsxSW()
 {
-	u8* ptr = rpsxGetConstantAddressOperand(true);
-	if (ptr)
-	{
-		const int rt = _allocX86reg(X86TYPE_PSX, _Rt_, MODE_READ);
-		xMOV(ptr32[ptr], xRegister32(rt));
-		return;
-	}
-
-	rpsxCalcAddressOperand();
-	rpsxCalcStoreOperand();
-	_psxFlushCall(FLUSH_FULLVTLB);
-	xFastCall((void*)iopMemWrite32);
+	rpsxStore(32);
 }
 
 //// SLL
@@ -32,6 +32,7 @@
 
 #include "common/AlignedMalloc.h"
 #include "common/FastJmp.h"
+#include "common/Perf.h"
 
 // Only for MOVQ workaround.
 #include "common/emitter/internal.h"
@@ -421,6 +422,8 @@ static void _DynGen_Dispatchers(void)
 	DispatchBlockDiscard = _DynGen_DispatchBlockDiscard();
 	DispatchPageReset = _DynGen_DispatchPageReset();
 
+	Perf::RegisterCode(Perf::Subsystem::EE, eeRecDispatchers, static_cast<u32>(xGetPtr() - eeRecDispatchers), "Dispatchers");
+
 	mode.m_write = false;
 	mode.m_exec  = true;
 	HostSys::MemProtect(eeRecDispatchers, __pagesize, mode);
@@ -1646,6 +1649,9 @@ static void recRecompile(const u32 startpc)
 
 	s_pCurBlockEx = recBlocks.New(HWADDR(startpc), (uptr)recPtr);
 
+	if (u32* counter = Perf::AllocateBlockCounter(Perf::Subsystem::EE, HWADDR(startpc)))
+		xADD(ptr32[xComplexAddress(rax, counter, xAddressVoid())], 1);
+
 	if (HWADDR(startpc) == EELOAD_START)
 	{
 		// The EELOAD _start function is the same across all BIOS versions
@@ -2033,6 +2039,7 @@ StartRecomp:
 	}
 
 	s_pCurBlockEx->x86size = static_cast<u32>(xGetPtr() - recPtr);
+	Perf::RegisterBlock(Perf::Subsystem::EE, recPtr, s_pCurBlockEx->x86size, HWADDR(startpc));
 
 	recPtr = xGetPtr();
 
@@ -29,6 +29,7 @@
 #include "R5900OpcodeTables.h"
 #include "VirtualMemory.h"
 #include "common/emitter/x86emitter.h"
+#include "common/Perf.h"
 #include "microVU_Misc.h"
 #include "microVU_IR.h"
 
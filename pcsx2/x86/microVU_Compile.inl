@@ -875,7 +875,11 @@ __fi void* mVUentryGet(microVU& mVU, microBlockManager* block, u32 startPC, uptr
 	microBlock* pBlock = block->search(mVU, (microRegInfo*)pState);
 	if (pBlock)
 		return pBlock->x86ptrStart;
-	return mVUcompile(mVU, startPC, pState);
+
+	void* entry = mVUcompile(mVU, startPC, pState);
+	Perf::RegisterBlock(isVU1 ? Perf::Subsystem::VU1 : Perf::Subsystem::VU0, entry,
+		static_cast<u32>(x86Ptr - static_cast<u8*>(entry)), startPC);
+	return entry;
 }
 
 // Search for Existing Compiled Block (if found, return x86ptr; else, compile and return x86ptr)
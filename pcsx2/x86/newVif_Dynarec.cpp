@@ -18,6 +18,7 @@
 //			Jake.Stine (@gmail.com)
 
 #include "newVif_UnpackSSE.h"
+#include "common/Perf.h"
 #include "MTVU.h"
 
 void dVifReserve(int idx)
@@ -322,11 +323,17 @@ _vifT __fi nVifBlock* dVifCompile(nVifBlock& block, bool isFill)
 	v.vifBlocks.add(block);
 
 	VifUnpackSSE_Dynarec(v, block).CompileRoutine();
+	Perf::RegisterBlock(idx ? Perf::Subsystem::VIF1 : Perf::Subsystem::VIF0, (void*)block.startPtr,
+		static_cast<u32>(xGetPtr() - (u8*)block.startPtr), block.upkType);
 	v.recWritePtr = xGetPtr();
 
 	return &block;
 }
 
+// Linear copy of VU memory for unpacks which wrap around its end. VIF0 runs on
+// the EE thread and VIF1 possibly on the MTVU thread, so each gets its own.
+alignas(16) static u8 s_wrapBuffer[2][0x4000];
+
 _vifT __fi void dVifUnpack(const u8* data, bool isFill)
 {
 	nVifStruct&   v       = nVif[idx];
@@ -372,9 +379,27 @@ _vifT __fi void dVifUnpack(const u8* data, bool isFill)
 
 		// No wrapping, you can run the fast dynarec
 		if (likely((startmem + b->length) <= endmem))
+		{
 			((nVifrecCall)b->startPtr)((uptr)startmem, (uptr)data);
+		}
+		else if (b->length <= vuMemLimit)
+		{
+			// Wraps once: run the block on a linear copy, so skipped and write
+			// masked vectors keep their contents, then copy both halves back.
+			u8* buffer = s_wrapBuffer[idx];
+			const uint head = static_cast<uint>(endmem - startmem);
+			const uint tail = b->length - head;
+
+			std::memcpy(buffer, startmem, head);
+			std::memcpy(buffer + head, VU.Mem, tail);
+			((nVifrecCall)b->startPtr)((uptr)buffer, (uptr)data);
+			std::memcpy(startmem, buffer, head);
+			std::memcpy(VU.Mem, buffer + head, tail);
+		}
 		else
+		{
 			_nVifUnpack(idx, data, vifRegs.mode, isFill);
+		}
 	}
 }
 
@@ -0,0 +1,433 @@
+#!/usr/bin/env python3
+
+# PCSX2 - PS2 Emulator for PCs
+# Copyright (C) 2002-2023  PCSX2 Dev Team
+#
+# PCSX2 is free software: you can redistribute it and/or modify it under the terms
+# of the GNU Lesser General Public License as published by the Free Software Found-
+# ation, either version 3 of the License, or (at your option) any later version.
+#
+# PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+# without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+# PURPOSE.  See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with PCSX2.
+# If not, see <http://www.gnu.org/licenses/>.
+
+# Packs a game's texture replacement directory into a single replacements.pack, which
+# GSTextureReplacements maps read-only and uploads from directly, instead of opening and
+# decoding every file on its own. Files which can't be packed are reported and can be left
+# in the replacements directory; loose files are still loaded, and win over the pack.
+#
+# Layout (little-endian), must match TexturePackHeader/TexturePackEntry in
+# pcsx2/GS/Renderers/HW/GSTextureReplacements.cpp:
+#   header:  char magic[8] "PCSX2TPK", u32 version, u32 count, u64 entries_offset
+#   entries: count * { TextureName name (u64 tex0_hash, u64 clut_hash, u32 region_width,
+#            u32 region_height, u32 bits, u32 miplevel), u32 format, u32 width, u32 height,
+#            u32 pitch, u32 mip_count, u8 alpha_min, u8 alpha_max, u16 reserved,
+#            u64 data_offset, u64 data_size }, sorted by the raw bytes of the name
+#   data:    per entry, the base level followed by its mips, 16 byte aligned
+#
+# DDS files in BC1/BC2/BC3/BC7 are stored as they are. Uncompressed DDS and PNG files are
+# converted to RGBA8 the same way the emulator's loaders do it (PNG needs Pillow).
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+PACK_MAGIC = b"PCSX2TPK"
+PACK_VERSION = 1
+HEADER_FORMAT = "<8sIIQ"
+NAME_FORMAT = "<QQIIII"
+ENTRY_FORMAT = "<32sIIIIIBBHQQ"
+DATA_ALIGNMENT = 16
+
+FORMAT_RGBA8 = 0
+FORMAT_BC1 = 1
+FORMAT_BC2 = 2
+FORMAT_BC3 = 3
+FORMAT_BC7 = 4
+
+# Bytes per 4x4 block, or per pixel for RGBA8.
+FORMAT_BLOCK = {
+    FORMAT_RGBA8: (1, 4),
+    FORMAT_BC1: (4, 8),
+    FORMAT_BC2: (4, 16),
+    FORMAT_BC3: (4, 16),
+    FORMAT_BC7: (4, 16),
+}
+
+HEX = r"([0-9a-fA-F]+)"
+BITS = r"([0-9a-fA-F]{1,8})\."
+DEC = r"([0-9]+)"
+
+# Same order as ParseReplacementName(); the first match wins.
+NAME_PATTERNS = [
+    ("region_clut", re.compile("^" + HEX + "-" + HEX + "-r" + DEC + "x" + DEC + "-" + BITS)),
+    ("region", re.compile("^" + HEX + "-r" + DEC + "x" + DEC + "-" + BITS)),
+    ("old_region_clut", re.compile("^" + HEX + "-" + HEX + "-r" + HEX + "-" + BITS)),
+    ("old_region", re.compile("^" + HEX + "-r" + HEX + "-" + BITS)),
+    ("clut", re.compile("^" + HEX + "-" + HEX + "-" + BITS)),
+    ("plain", re.compile("^" + HEX + "-" + BITS)),
+]
+
+UNUSED_BITS_MASK = ~(1 << 14) & 0xFFFFFFFF
+
+DDS_MAGIC = 0x20534444
+DDS_FOURCC = 0x4
+DDS_RGB = 0x40
+DDS_RGBA = 0x41
+DDS_HEADER_FLAGS_MIPMAP = 0x00020000
+DDS_HEADER_FLAGS_VOLUME = 0x00800000
+DDS_HEADER_FLAGS_PITCH = 0x00000008
+DDS_HEADER_FLAGS_LINEARSIZE = 0x00080000
+DDS_MAX_TEXTURE_SIZE = 32768
+DDS_DIMENSION_TEXTURE2D = 3
+
+DDSPF_A8R8G8B8 = (32, DDS_RGBA, 0, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000)
+DDSPF_X8R8G8B8 = (32, DDS_RGB, 0, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0x00000000)
+DDSPF_A8B8G8R8 = (32, DDS_RGBA, 0, 32, 0x000000ff, 0x0000ff00, 0x00ff0000, 0xff000000)
+DDSPF_X8B8G8R8 = (32, DDS_RGB, 0, 32, 0x000000ff, 0x0000ff00, 0x00ff0000, 0x00000000)
+DDSPF_R8G8B8 = (32, DDS_RGB, 0, 24, 0x00ff0000, 0x0000ff00, 0x000000ff, 0x00000000)
+
+
+class PackError(Exception):
+    pass
+
+
+def fourcc(s):
+    return struct.unpack("<I", s.encode("ascii"))[0]
+
+
+def to_u32(value):
+    return value & 0xFFFFFFFF
+
+
+def to_s16(value):
+    value &= 0xFFFF
+    return value - 0x10000 if value & 0x8000 else value
+
+
+def parse_replacement_name(filename):
+    """Returns the packed TextureName for a replacement filename, or None."""
+    for kind, pattern in NAME_PATTERNS:
+        m = pattern.match(filename)
+        if not m:
+            continue
+
+        g = m.groups()
+        tex0 = int(g[0], 16) & 0xFFFFFFFFFFFFFFFF
+        clut = 0
+        rw = rh = 0
+        if kind == "region_clut":
+            clut = int(g[1], 16)
+            rw, rh, bits = int(g[2]), int(g[3]), int(g[4], 16)
+        elif kind == "region":
+            rw, rh, bits = int(g[1]), int(g[2]), int(g[3], 16) & UNUSED_BITS_MASK
+        elif kind in ("old_region_clut", "old_region"):
+            if kind == "old_region_clut":
+                clut = int(g[1], 16)
+                g = (g[0],) + g[2:]
+            region = int(g[1], 16)
+            bits = int(g[2], 16) & UNUSED_BITS_MASK
+            rw = to_u32(to_s16(region >> 16) - to_s16(region))
+            rh = to_u32(to_s16(region >> 48) - to_s16(region >> 32))
+        elif kind == "clut":
+            clut, bits = int(g[1], 16), int(g[2], 16) & UNUSED_BITS_MASK
+        else:
+            bits = int(g[1], 16) & UNUSED_BITS_MASK
+
+        return struct.pack(NAME_FORMAT, tex0, clut & 0xFFFFFFFFFFFFFFFF, to_u32(rw), to_u32(rh), bits, 0)
+
+    return None
+
+
+def block_count(extent, block_size):
+    return max((extent + block_size - 1) // block_size, 1)
+
+
+def level_layout(fmt, width, height, level):
+    block_size, bytes_per_block = FORMAT_BLOCK[fmt]
+    w = max(width >> level, 1)
+    h = max(height >> level, 1)
+    pitch = block_count(w, block_size) * bytes_per_block
+    return w, h, pitch, pitch * block_count(h, block_size)
+
+
+def bc1_alpha(data):
+    has_opaque = has_transparent = False
+    for c0, c1, indices in struct.iter_unpack("<HHI", data):
+        if c0 > c1:
+            has_opaque = True
+            continue
+        # Three colour mode, index 3 is transparent black.
+        idx3 = indices & (indices >> 1) & 0x55555555
+        if idx3:
+            has_transparent = True
+        if idx3 != 0x55555555:
+            has_opaque = True
+        if has_opaque and has_transparent:
+            break
+    return (0 if has_transparent else 255, 255 if has_opaque else 0)
+
+
+def bc2_alpha(data):
+    alpha = b"".join(data[i:i + 8] for i in range(0, len(data), 16))
+    lo = alpha.translate(bytes((i & 0xF) for i in range(256)))
+    hi = alpha.translate(bytes((i >> 4) for i in range(256)))
+    return (min(min(lo), min(hi)) * 17, max(max(lo), max(hi)) * 17)
+
+
+def bc3_alpha(data):
+    # Bounds from the endpoints, so this can be wider than the texels actually used.
+    amin, amax = 255, 0
+    for i in range(0, len(data), 16):
+        a0, a1 = data[i], data[i + 1]
+        if a0 > a1:
+            amin, amax = min(amin, a1), max(amax, a0)
+        else:
+            amin, amax = 0, 255
+            break
+    return (amin, amax)
+
+
+def bc7_alpha(data):
+    # Modes 0-3 don't carry alpha; anything else is assumed to use the whole range.
+    for i in range(0, len(data), 16):
+        if (data[i] & 0x0F) == 0:
+            return (0, 255)
+    return (255, 255)
+
+
+def rgba8_alpha(data):
+    alpha = data[3::4]
+    return (min(alpha), max(alpha))
+
+
+def convert_rows(data, width, height, src_pitch, src_bpp, convert):
+    out = bytearray()
+    for y in range(height):
+        row = data[y * src_pitch:y * src_pitch + width * src_bpp]
+        out += convert(row)
+    return bytes(out)
+
+
+def swap_rb(row, alpha=None):
+    out = bytearray(len(row))
+    out[0::4] = row[2::4]
+    out[1::4] = row[1::4]
+    out[2::4] = row[0::4]
+    out[3::4] = row[3::4] if alpha is None else bytes([alpha]) * (len(row) // 4)
+    return bytes(out)
+
+
+def set_alpha(row, alpha):
+    out = bytearray(row)
+    out[3::4] = bytes([alpha]) * (len(row) // 4)
+    return bytes(out)
+
+
+def bgr_to_rgba(row):
+    count = len(row) // 3
+    out = bytearray(count * 4)
+    out[0::4] = row[2::3]
+    out[1::4] = row[1::3]
+    out[2::4] = row[0::3]
+    out[3::4] = b"\xff" * count
+    return bytes(out)
+
+
+def load_dds(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if len(data) < 128 or struct.unpack_from("<I", data, 0)[0] != DDS_MAGIC:
+        raise PackError("not a DDS file")
+
+    (size, flags, height, width, pitch_or_linear, _depth, mip_map_count) = struct.unpack_from("<7I", data, 4)
+    ddspf = struct.unpack_from("<8I", data, 4 + 72)
+    if size < 124 or width == 0 or height == 0 or width >= DDS_MAX_TEXTURE_SIZE or height >= DDS_MAX_TEXTURE_SIZE:
+        raise PackError("invalid header")
+    if flags & DDS_HEADER_FLAGS_VOLUME:
+        raise PackError("volume textures are not supported")
+
+    if flags & DDS_HEADER_FLAGS_MIPMAP:
+        mip_count = mip_map_count if mip_map_count else (max(width, height).bit_length())
+    else:
+        mip_count = 1
+
+    offset = 4 + 124
+    convert = None
+    src_bpp = 4
+    if ddspf[1] & DDS_FOURCC:
+        dxgi = 0
+        if ddspf[2] == fourcc("DX10"):
+            if len(data) < offset + 20:
+                raise PackError("truncated DX10 header")
+            dxgi, dimension, _misc, array_size = struct.unpack_from("<4I", data, offset)
+            if dimension != DDS_DIMENSION_TEXTURE2D or array_size != 1:
+                raise PackError("array textures are not supported")
+            offset += 20
+
+        if ddspf[2] == fourcc("DXT1") or dxgi == 71:
+            fmt = FORMAT_BC1
+        elif ddspf[2] in (fourcc("DXT2"), fourcc("DXT3")) or dxgi == 74:
+            fmt = FORMAT_BC2
+        elif ddspf[2] in (fourcc("DXT4"), fourcc("DXT5")) or dxgi == 77:
+            fmt = FORMAT_BC3
+        elif dxgi == 98:
+            fmt = FORMAT_BC7
+        else:
+            raise PackError("unsupported compressed format")
+
+        if (width % 4) != 0 or (height % 4) != 0:
+            raise PackError("compressed textures must be a multiple of 4 in size")
+    else:
+        fmt = FORMAT_RGBA8
+        if ddspf == DDSPF_A8B8G8R8:
+            convert = lambda row: row
+        elif ddspf == DDSPF_A8R8G8B8:
+            convert = swap_rb
+        elif ddspf == DDSPF_X8R8G8B8:
+            convert = lambda row: swap_rb(row, 0xFF)
+        elif ddspf == DDSPF_X8B8G8R8:
+            convert = lambda row: set_alpha(row, 0x80)
+        elif ddspf == DDSPF_R8G8B8:
+            convert = bgr_to_rgba
+            src_bpp = 3
+        else:
+            raise PackError("unsupported pixel format")
+
+    block_size, bytes_per_block = FORMAT_BLOCK[fmt]
+    if convert:
+        bytes_per_block = src_bpp
+
+    # Base pitch can come from the header, mips are always tightly packed.
+    if (flags & DDS_HEADER_FLAGS_PITCH) and (flags & DDS_HEADER_FLAGS_LINEARSIZE):
+        if pitch_or_linear < bytes_per_block:
+            raise PackError("invalid pitch")
+        base_pitch = pitch_or_linear
+    else:
+        base_pitch = block_count(width, block_size) * bytes_per_block
+
+    levels = []
+    for level in range(0, mip_count + 1):
+        w = max(width >> level, 1)
+        h = max(height >> level, 1)
+        pitch = base_pitch if level == 0 else block_count(w, block_size) * bytes_per_block
+        size = pitch * block_count(h, block_size)
+        if offset + size > len(data):
+            if level == 0:
+                raise PackError("truncated base image")
+            break
+        levels.append(data[offset:offset + size] if not convert else
+                      convert_rows(data[offset:offset + size], w, h, pitch, src_bpp, convert))
+        offset += size
+
+    # Converted levels are tightly packed RGBA8.
+    pitch = base_pitch if not convert else width * 4
+    return fmt, width, height, pitch, levels
+
+
+def load_png(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        raise PackError("Pillow is required to pack PNG files")
+
+    with Image.open(path) as img:
+        if img.mode == "RGBA":
+            data = img.tobytes()
+        elif img.mode == "RGB":
+            # Matches PNGLoader, which makes RGB images opaque in PS2 terms.
+            data = set_alpha(img.convert("RGBA").tobytes(), 0x80)
+        else:
+            raise PackError("unsupported PNG mode %s" % img.mode)
+        return FORMAT_RGBA8, img.width, img.height, img.width * 4, [data]
+
+
+def alpha_minmax(fmt, base):
+    if fmt == FORMAT_BC1:
+        return bc1_alpha(base)
+    elif fmt == FORMAT_BC2:
+        return bc2_alpha(base)
+    elif fmt == FORMAT_BC3:
+        return bc3_alpha(base)
+    elif fmt == FORMAT_BC7:
+        return bc7_alpha(base)
+    else:
+        return rgba8_alpha(base)
+
+
+def build_pack(replacements_dir, pack_path):
+    textures = {}
+    skipped = 0
+    for root, dirs, files in os.walk(replacements_dir):
+        dirs.sort()
+        for filename in sorted(files):
+            ext = os.path.splitext(filename)[1]
+            if ext not in (".png", ".dds"):
+                continue
+
+            name = parse_replacement_name(filename)
+            if name is None:
+                continue
+
+            path = os.path.join(root, filename)
+            if name in textures:
+                print("Duplicate replacement %s, skipping" % path, file=sys.stderr)
+                continue
+
+            try:
+                textures[name] = load_dds(path) if ext == ".dds" else load_png(path)
+            except PackError as e:
+                print("Skipping %s: %s (leave it in the replacements directory)" % (path, e), file=sys.stderr)
+                skipped += 1
+
+    names = sorted(textures.keys())
+    header_size = struct.calcsize(HEADER_FORMAT)
+    entry_size = struct.calcsize(ENTRY_FORMAT)
+    data_start = header_size + len(names) * entry_size
+
+    entries = bytearray()
+    payload = bytearray()
+    for name in names:
+        fmt, width, height, pitch, levels = textures[name]
+        amin, amax = alpha_minmax(fmt, levels[0])
+
+        pad = (-(data_start + len(payload))) % DATA_ALIGNMENT
+        payload += b"\0" * pad
+        offset = data_start + len(payload)
+        for level in levels:
+            payload += level
+
+        entries += struct.pack(ENTRY_FORMAT, name, fmt, width, height, pitch, len(levels) - 1,
+                               amin, amax, 0, offset, data_start + len(payload) - offset)
+
+    with open(pack_path, "wb") as f:
+        f.write(struct.pack(HEADER_FORMAT, PACK_MAGIC, PACK_VERSION, len(names), header_size))
+        f.write(entries)
+        f.write(payload)
+
+    print("Wrote %d textures to %s (%d skipped)" % (len(names), pack_path, skipped))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Builds a replacements.pack from a texture replacement directory.")
+    parser.add_argument("directory", help="Game texture directory (e.g. textures/SLUS-12345), or its replacements subdirectory")
+    parser.add_argument("-o", "--output", help="Output pack, defaults to replacements.pack in the game texture directory")
+    args = parser.parse_args()
+
+    directory = os.path.normpath(args.directory)
+    if os.path.basename(directory) == "replacements":
+        game_dir, replacements_dir = os.path.dirname(directory), directory
+    else:
+        game_dir, replacements_dir = directory, os.path.join(directory, "replacements")
+
+    if not os.path.isdir(replacements_dir):
+        print("%s is not a directory" % replacements_dir, file=sys.stderr)
+        sys.exit(1)
+
+    build_pack(replacements_dir, args.output or os.path.join(game_dir, "replacements.pack"))
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+
+# PCSX2 - PS2 Emulator for PCs
+# Copyright (C) 2002-2023  PCSX2 Dev Team
+#
+# PCSX2 is free software: you can redistribute it and/or modify it under the terms
+# of the GNU Lesser General Public License as published by the Free Software Found-
+# ation, either version 3 of the License, or (at your option) any later version.
+#
+# PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+# without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+# PURPOSE.  See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with PCSX2.
+# If not, see <http://www.gnu.org/licenses/>.
+
+# Compiles GameIndex.yaml into GameIndex.bin, the sorted serial index GameDatabase
+# mmaps at startup so it only has to parse the entry for the game being booted.
+# Run this whenever GameIndex.yaml changes and ship the result next to it; the
+# emulator falls back to parsing the whole YAML if the index is missing or stale.
+#
+# Layout (little-endian), must match GameIndexHeader/GameIndexEntry in pcsx2/GameDatabase.cpp:
+#   header:  char magic[8] "GDBINDEX", u32 version, u32 count, u64 yaml_size,
+#            u64 yaml_hash (XXH64 of the YAML, seed 0), u32 entries_offset, u32 strings_offset
+#   entries: count * { u32 serial_offset, u32 serial_length, u32 yaml_offset, u32 yaml_length }
+#   strings: lower-case serials, not terminated
+
+import os
+import re
+import struct
+import sys
+
+INDEX_MAGIC = b"GDBINDEX"
+INDEX_VERSION = 2
+HEADER_FORMAT = "<8sIIQQII"
+ENTRY_FORMAT = "<IIII"
+
+XXH_PRIME64_1 = 0x9E3779B185EBCA87
+XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4F
+XXH_PRIME64_3 = 0x165667B19E3779F9
+XXH_PRIME64_4 = 0x85EBCA77C2B2AE63
+XXH_PRIME64_5 = 0x27D4EB2F165667C5
+MASK64 = 0xFFFFFFFFFFFFFFFF
+
+def _rotl64(x, r):
+    return ((x << r) | (x >> (64 - r))) & MASK64
+
+def _xxh64_round(acc, lane):
+    acc = (acc + lane * XXH_PRIME64_2) & MASK64
+    return (_rotl64(acc, 31) * XXH_PRIME64_1) & MASK64
+
+def _xxh64_merge_round(acc, val):
+    acc ^= _xxh64_round(0, val)
+    return (acc * XXH_PRIME64_1 + XXH_PRIME64_4) & MASK64
+
+# XXH64 with seed 0, as GameDatabase checks it with the vendored xxhash.h.
+# Plain Python so the script has no dependencies; the YAML is only a few MB.
+def xxh64(data):
+    length = len(data)
+    pos = 0
+    if length >= 32:
+        v1 = (XXH_PRIME64_1 + XXH_PRIME64_2) & MASK64
+        v2 = XXH_PRIME64_2
+        v3 = 0
+        v4 = (-XXH_PRIME64_1) & MASK64
+        stripes = struct.iter_unpack("<QQQQ", memoryview(data)[:length - length % 32])
+        for l1, l2, l3, l4 in stripes:
+            v1 = _xxh64_round(v1, l1)
+            v2 = _xxh64_round(v2, l2)
+            v3 = _xxh64_round(v3, l3)
+            v4 = _xxh64_round(v4, l4)
+        pos = length - length % 32
+        h = (_rotl64(v1, 1) + _rotl64(v2, 7) + _rotl64(v3, 12) + _rotl64(v4, 18)) & MASK64
+        h = _xxh64_merge_round(h, v1)
+        h = _xxh64_merge_round(h, v2)
+        h = _xxh64_merge_round(h, v3)
+        h = _xxh64_merge_round(h, v4)
+    else:
+        h = XXH_PRIME64_5
+
+    h = (h + length) & MASK64
+
+    while pos + 8 <= length:
+        (lane,) = struct.unpack_from("<Q", data, pos)
+        h ^= _xxh64_round(0, lane)
+        h = (_rotl64(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4) & MASK64
+        pos += 8
+    if pos + 4 <= length:
+        (lane,) = struct.unpack_from("<I", data, pos)
+        h ^= (lane * XXH_PRIME64_1) & MASK64
+        h = (_rotl64(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3) & MASK64
+        pos += 4
+    while pos < length:
+        h ^= (data[pos] * XXH_PRIME64_5) & MASK64
+        h = (_rotl64(h, 11) * XXH_PRIME64_1) & MASK64
+        pos += 1
+
+    h ^= h >> 33
+    h = (h * XXH_PRIME64_2) & MASK64
+    h ^= h >> 29
+    h = (h * XXH_PRIME64_3) & MASK64
+    h ^= h >> 32
+    return h
+
+# Top-level keys are serials at column zero, optionally followed by a comment.
+KEY_RE = re.compile(rb"^([^\s#:][^:]*):[ \t]*(#.*)?$")
+
+def compile_index(yaml_path, index_path):
+    with open(yaml_path, "rb") as f:
+        data = f.read()
+
+    keys = []
+    offset = 0
+    for line in data.splitlines(keepends=True):
+        m = KEY_RE.match(line.rstrip(b"\r\n"))
+        if m:
+            keys.append((m.group(1).decode("utf-8").strip().lower(), offset))
+        offset += len(line)
+
+    entries = {}
+    for i, (serial, start) in enumerate(keys):
+        end = keys[i + 1][1] if (i + 1) < len(keys) else len(data)
+        # Serials are case-insensitive, the first one wins like in GameDatabase::initDatabase().
+        if serial in entries:
+            print("Duplicate serial '%s', skipping" % serial, file=sys.stderr)
+            continue
+        entries[serial] = (start, end - start)
+
+    serials = sorted(entries.keys())
+    header_size = struct.calcsize(HEADER_FORMAT)
+    entries_offset = header_size
+    strings_offset = entries_offset + len(serials) * struct.calcsize(ENTRY_FORMAT)
+
+    strings = bytearray()
+    packed_entries = bytearray()
+    for serial in serials:
+        encoded = serial.encode("utf-8")
+        yaml_offset, yaml_length = entries[serial]
+        packed_entries += struct.pack(ENTRY_FORMAT, len(strings), len(encoded), yaml_offset, yaml_length)
+        strings += encoded
+
+    with open(index_path, "wb") as f:
+        f.write(struct.pack(HEADER_FORMAT, INDEX_MAGIC, INDEX_VERSION, len(serials), len(data), xxh64(data),
+                            entries_offset, strings_offset))
+        f.write(packed_entries)
+        f.write(strings)
+
+    print("Wrote %d serials to %s" % (len(serials), index_path))
+
+if __name__ == "__main__":
+    resources_dir = os.path.join(os.path.dirname(__file__), "..", "bin", "resources")
+    yaml_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(resources_dir, "GameIndex.yaml")
+    index_path = sys.argv[2] if len(sys.argv) > 2 else os.path.join(os.path.dirname(yaml_path), "GameIndex.bin")
+    compile_index(yaml_path, index_path)